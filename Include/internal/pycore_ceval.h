@@ -439,7 +439,8 @@ PyAPI_FUNC(PyObject *)
 _Py_BuiltinCallFastWithKeywords_StackRef(
     _PyStackRef callable,
     _PyStackRef *arguments,
-    int total_args);
+    int total_args,
+    PyObject *kwnames);
 
 PyAPI_FUNC(PyObject *)
 _PyCallMethodDescriptorFast_StackRef(
@@ -455,13 +456,15 @@ _PyCallMethodDescriptorFastWithKeywords_StackRef(
     PyCFunctionFastWithKeywords cfunc,
     PyObject *self,
     _PyStackRef *arguments,
-    int total_args);
+    int total_args,
+    PyObject *kwnames);
 
 PyAPI_FUNC(PyObject *)
 _Py_CallBuiltinClass_StackRef(
     _PyStackRef callable,
     _PyStackRef *arguments,
-    int total_args);
+    int total_args,
+    PyObject *kwnames);
 
 PyAPI_FUNC(PyObject *)
 _Py_BuildString_StackRefSteal(
@@ -323,6 +323,14 @@ PyAPI_FUNC(PyObject *)_PyDict_FromItems(
         PyObject *const *values, Py_ssize_t values_offset,
         Py_ssize_t length);
 
+// Export for '_csv' and '_json' shared extensions
+PyAPI_FUNC(PyObject *) _PyDict_NewTemplate(PyObject *const *keys,
+                                           Py_ssize_t length);
+PyAPI_FUNC(PyObject *) _PyDict_FromTemplate(PyObject *template,
+                                            PyObject *const *keys,
+                                            PyObject *const *values,
+                                            Py_ssize_t length);
+
 static inline uint8_t *
 get_insertion_order_array(PyDictValues *values)
 {
@@ -322,6 +322,8 @@ extern void _PyGC_CollectNoFail(PyThreadState *tstate);
 extern void _PyGC_Freeze(PyInterpreterState *interp);
 /* Unfreezes objects placing them in the oldest generation */
 extern void _PyGC_Unfreeze(PyInterpreterState *interp);
+/* Makes frozen objects and the objects they refer to immortal */
+extern int _PyGC_ImmortalizeFrozen(PyInterpreterState *interp);
 /* Number of frozen objects */
 extern Py_ssize_t _PyGC_GetFreezeCount(PyInterpreterState *interp);
 
@@ -541,6 +541,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(ignore)
         STRUCT_FOR_ID(ignorechars)
         STRUCT_FOR_ID(imag)
+        STRUCT_FOR_ID(immortalize)
         STRUCT_FOR_ID(implieslink)
         STRUCT_FOR_ID(importlib)
         STRUCT_FOR_ID(in_fd)
@@ -708,6 +709,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(path)
         STRUCT_FOR_ID(pattern)
         STRUCT_FOR_ID(peek)
+        STRUCT_FOR_ID(period)
         STRUCT_FOR_ID(persistent_id)
         STRUCT_FOR_ID(persistent_load)
         STRUCT_FOR_ID(person)
@@ -263,6 +263,9 @@ struct _gc_runtime_state {
 #ifdef Py_GIL_DISABLED
     /* True if gc.freeze() has been used. */
     int freeze_active;
+    /* Number of threads used by the "mark alive" pass, or 0 to choose it
+       from the number of threads and the size of the heap. */
+    int mark_alive_workers;
 #else
     PyGC_Head *generation0;
 #endif
@@ -444,6 +447,9 @@ typedef struct _PyOptimizationConfig {
     // Trace fitness thresholds
     uint16_t fitness_initial;
 
+    // Memory budget for executors, in bytes (0 means unlimited)
+    size_t executor_memory_limit;
+
     // Optimization flags
     bool specialization_enabled;
     bool uops_optimize_enabled;
@@ -824,6 +830,16 @@ struct _Py_unique_id_pool {
 
 typedef _Py_CODEUNIT *(*_PyJitEntryFuncPtr)(struct _PyExecutorObject *exec, _PyInterpreterFrame *frame, _PyStackRef *stack_pointer, PyThreadState *tstate);
 
+#define _PY_EVICTED_EXECUTOR_SITES 64  /* Must be a power of 2 */
+
+/* An event recorded by sys._jit.start_sampling() */
+typedef struct _PyJitSample {
+    PyCodeObject *code;  // Borrowed, cleared when the code object is freed
+    int32_t offset;      // In code units
+    uint8_t kind;        // One of the _PyJitSample_* kinds
+    uint8_t opcode;      // The instruction at offset when the event happened
+} _PyJitSample;
+
 #define _PyInterpreterGuard_GUARDS_NOT_ALLOWED UINTPTR_MAX
 
 /* PyInterpreterState holds the global state for one of the runtime's
@@ -1015,6 +1031,17 @@ struct _is {
     struct _PyExecutorObject *cold_executor;
     struct _PyExecutorObject *cold_dynamic_executor;
     size_t executor_creation_counter;
+    size_t executor_memory;                      // Bytes used by valid executors
+    size_t executors_created;
+    size_t executors_evicted;
+    size_t executors_recompiled;
+    // Start instructions of recently evicted executors, to detect recompilation
+    _Py_CODEUNIT *evicted_executor_sites[_PY_EVICTED_EXECUTOR_SITES];
+    _PyJitSample *jit_samples;                   // Ring buffer, or NULL
+    size_t jit_samples_size;
+    size_t jit_samples_count;                    // Events recorded so far
+    uint32_t jit_samples_period;                 // Record one in this many
+    uint32_t jit_samples_countdown;
     _rare_events rare_events;
     PyDict_WatchCallback builtins_dict_watcher;
 
@@ -719,6 +719,8 @@ extern bool _PyMem_obmalloc_state_on_heap(PyInterpreterState *interp);
 #ifdef WITH_PYMALLOC
 // Export the symbol for the 3rd party 'guppy3' project
 PyAPI_FUNC(int) _PyObject_DebugMallocStats(FILE *out);
+// Return the free memory of the object allocator to the system
+extern size_t _PyObject_ReleaseFreeMemory(void);
 #endif
 
 
@@ -307,6 +307,26 @@ PyAPI_FUNC(void) _Py_Executors_InvalidateCold(PyInterpreterState *interp);
 // This value is arbitrary and was not optimized.
 #define JIT_CLEANUP_THRESHOLD 1000
 
+/* Kinds of events recorded by sys._jit.start_sampling() */
+enum {
+    _PyJitSample_ENTER,     // An executor was entered from tier 1
+    _PyJitSample_EXIT,      // Execution returned to tier 1
+    _PyJitSample_COMPILE,   // A trace was turned into an executor
+    _PyJitSample_ABORT,     // A trace was discarded
+};
+
+#ifdef _Py_TIER2
+PyAPI_FUNC(int) _PyJit_StartSampling(PyInterpreterState *interp,
+                                     Py_ssize_t size, int period);
+PyAPI_FUNC(void) _PyJit_StopSampling(PyInterpreterState *interp);
+PyAPI_FUNC(PyObject *) _PyJit_GetSamples(PyInterpreterState *interp);
+PyAPI_FUNC(void) _PyJit_SampleForgetCode(PyInterpreterState *interp,
+                                         PyCodeObject *code);
+PyAPI_FUNC(void) _PyJit_Sample(PyThreadState *tstate, int kind,
+                               _PyInterpreterFrame *frame,
+                               _Py_CODEUNIT *instr);
+#endif
+
 int _Py_uop_analyze_and_optimize(
     _PyThreadStateImpl *tstate,
     _PyUOpInstruction *input, int trace_len, int curr_stackentries,
@@ -1816,6 +1816,7 @@ extern "C" {
     INIT_ID(ignore), \
     INIT_ID(ignorechars), \
     INIT_ID(imag), \
+    INIT_ID(immortalize), \
     INIT_ID(implieslink), \
     INIT_ID(importlib), \
     INIT_ID(in_fd), \
@@ -1983,6 +1984,7 @@ extern "C" {
     INIT_ID(path), \
     INIT_ID(pattern), \
     INIT_ID(peek), \
+    INIT_ID(period), \
     INIT_ID(persistent_id), \
     INIT_ID(persistent_load), \
     INIT_ID(person), \
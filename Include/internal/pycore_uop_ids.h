@@ -16,37 +16,44 @@ extern "C" {
 #define _BINARY_OP_ADD_FLOAT 304
 #define _BINARY_OP_ADD_FLOAT_INPLACE 305
 #define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT 306
-#define _BINARY_OP_ADD_INT 307
-#define _BINARY_OP_ADD_INT_INPLACE 308
-#define _BINARY_OP_ADD_INT_INPLACE_RIGHT 309
-#define _BINARY_OP_ADD_UNICODE 310
-#define _BINARY_OP_EXTEND 311
-#define _BINARY_OP_INPLACE_ADD_UNICODE 312
-#define _BINARY_OP_MULTIPLY_FLOAT 313
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE 314
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT 315
-#define _BINARY_OP_MULTIPLY_INT 316
-#define _BINARY_OP_MULTIPLY_INT_INPLACE 317
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT 318
-#define _BINARY_OP_SUBSCR_CHECK_FUNC 319
-#define _BINARY_OP_SUBSCR_DICT 320
-#define _BINARY_OP_SUBSCR_DICT_KNOWN_HASH 321
-#define _BINARY_OP_SUBSCR_INIT_CALL 322
-#define _BINARY_OP_SUBSCR_LIST_INT 323
-#define _BINARY_OP_SUBSCR_LIST_SLICE 324
-#define _BINARY_OP_SUBSCR_STR_INT 325
-#define _BINARY_OP_SUBSCR_TUPLE_INT 326
-#define _BINARY_OP_SUBSCR_USTR_INT 327
-#define _BINARY_OP_SUBTRACT_FLOAT 328
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE 329
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT 330
-#define _BINARY_OP_SUBTRACT_INT 331
-#define _BINARY_OP_SUBTRACT_INT_INPLACE 332
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT 333
-#define _BINARY_OP_TRUEDIV_FLOAT 334
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE 335
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT 336
-#define _BINARY_SLICE 337
+#define _BINARY_OP_ADD_FLOAT_INT_INPLACE 307
+#define _BINARY_OP_ADD_INT 308
+#define _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT 309
+#define _BINARY_OP_ADD_INT_INPLACE 310
+#define _BINARY_OP_ADD_INT_INPLACE_RIGHT 311
+#define _BINARY_OP_ADD_UNICODE 312
+#define _BINARY_OP_ADD_UNICODE_INPLACE 313
+#define _BINARY_OP_EXTEND 314
+#define _BINARY_OP_INPLACE_ADD_UNICODE 315
+#define _BINARY_OP_MULTIPLY_FLOAT 316
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE 317
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT 318
+#define _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE 319
+#define _BINARY_OP_MULTIPLY_INT 320
+#define _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT 321
+#define _BINARY_OP_MULTIPLY_INT_INPLACE 322
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT 323
+#define _BINARY_OP_SUBSCR_CHECK_FUNC 324
+#define _BINARY_OP_SUBSCR_DICT 325
+#define _BINARY_OP_SUBSCR_DICT_KNOWN_HASH 326
+#define _BINARY_OP_SUBSCR_INIT_CALL 327
+#define _BINARY_OP_SUBSCR_LIST_INT 328
+#define _BINARY_OP_SUBSCR_LIST_SLICE 329
+#define _BINARY_OP_SUBSCR_STR_INT 330
+#define _BINARY_OP_SUBSCR_TUPLE_INT 331
+#define _BINARY_OP_SUBSCR_USTR_INT 332
+#define _BINARY_OP_SUBTRACT_FLOAT 333
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE 334
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT 335
+#define _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE 336
+#define _BINARY_OP_SUBTRACT_INT 337
+#define _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT 338
+#define _BINARY_OP_SUBTRACT_INT_INPLACE 339
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT 340
+#define _BINARY_OP_TRUEDIV_FLOAT 341
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE 342
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT 343
+#define _BINARY_SLICE 344
 #define _BUILD_INTERPOLATION BUILD_INTERPOLATION
 #define _BUILD_LIST BUILD_LIST
 #define _BUILD_MAP BUILD_MAP
@@ -55,199 +62,205 @@ extern "C" {
 #define _BUILD_STRING BUILD_STRING
 #define _BUILD_TEMPLATE BUILD_TEMPLATE
 #define _BUILD_TUPLE BUILD_TUPLE
-#define _CALL_BUILTIN_CLASS 338
-#define _CALL_BUILTIN_FAST 339
-#define _CALL_BUILTIN_FAST_WITH_KEYWORDS 340
-#define _CALL_BUILTIN_O 341
-#define _CALL_FUNCTION_EX_NON_PY_GENERAL 342
-#define _CALL_INTRINSIC_1 343
-#define _CALL_INTRINSIC_2 344
-#define _CALL_ISINSTANCE 345
-#define _CALL_KW_NON_PY 346
-#define _CALL_LEN 347
-#define _CALL_LIST_APPEND 348
-#define _CALL_METHOD_DESCRIPTOR_FAST 349
-#define _CALL_METHOD_DESCRIPTOR_FAST_INLINE 350
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 351
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_INLINE 352
-#define _CALL_METHOD_DESCRIPTOR_NOARGS 353
-#define _CALL_METHOD_DESCRIPTOR_NOARGS_INLINE 354
-#define _CALL_METHOD_DESCRIPTOR_O 355
-#define _CALL_METHOD_DESCRIPTOR_O_INLINE 356
-#define _CALL_NON_PY_GENERAL 357
-#define _CALL_STR_1 358
-#define _CALL_TUPLE_1 359
-#define _CALL_TYPE_1 360
-#define _CHECK_ATTR_CLASS 361
-#define _CHECK_ATTR_METHOD_LAZY_DICT 362
-#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 363
+#define _CALL_BUILTIN_CLASS 345
+#define _CALL_BUILTIN_FAST 346
+#define _CALL_BUILTIN_FAST_WITH_KEYWORDS 347
+#define _CALL_BUILTIN_O 348
+#define _CALL_FUNCTION_EX_NON_PY_GENERAL 349
+#define _CALL_INTRINSIC_1 350
+#define _CALL_INTRINSIC_2 351
+#define _CALL_ISINSTANCE 352
+#define _CALL_KW_BUILTIN_CLASS 353
+#define _CALL_KW_BUILTIN_FAST 354
+#define _CALL_KW_METHOD_DESCRIPTOR_FAST 355
+#define _CALL_KW_NON_PY 356
+#define _CALL_LEN 357
+#define _CALL_LIST_APPEND 358
+#define _CALL_METHOD_DESCRIPTOR_FAST 359
+#define _CALL_METHOD_DESCRIPTOR_FAST_INLINE 360
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 361
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_INLINE 362
+#define _CALL_METHOD_DESCRIPTOR_NOARGS 363
+#define _CALL_METHOD_DESCRIPTOR_NOARGS_INLINE 364
+#define _CALL_METHOD_DESCRIPTOR_O 365
+#define _CALL_METHOD_DESCRIPTOR_O_INLINE 366
+#define _CALL_NON_PY_GENERAL 367
+#define _CALL_STR_1 368
+#define _CALL_TUPLE_1 369
+#define _CALL_TYPE_1 370
+#define _CHECK_ATTR_CLASS 371
+#define _CHECK_ATTR_METHOD_LAZY_DICT 372
+#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 373
 #define _CHECK_EG_MATCH CHECK_EG_MATCH
 #define _CHECK_EXC_MATCH CHECK_EXC_MATCH
-#define _CHECK_FUNCTION_EXACT_ARGS 364
-#define _CHECK_FUNCTION_VERSION 365
-#define _CHECK_FUNCTION_VERSION_INLINE 366
-#define _CHECK_FUNCTION_VERSION_KW 367
-#define _CHECK_IS_NOT_PY_CALLABLE 368
-#define _CHECK_IS_NOT_PY_CALLABLE_EX 369
-#define _CHECK_IS_NOT_PY_CALLABLE_KW 370
-#define _CHECK_IS_PY_CALLABLE_EX 371
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES 372
-#define _CHECK_METHOD_VERSION 373
-#define _CHECK_METHOD_VERSION_KW 374
-#define _CHECK_OBJECT 375
-#define _CHECK_PEP_523 376
-#define _CHECK_PERIODIC 377
-#define _CHECK_PERIODIC_AT_END 378
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 379
-#define _CHECK_RECURSION_LIMIT 380
-#define _CHECK_RECURSION_REMAINING 381
-#define _CHECK_STACK_SPACE 382
-#define _CHECK_STACK_SPACE_OPERAND 383
-#define _CHECK_VALIDITY 384
-#define _COLD_DYNAMIC_EXIT 385
-#define _COLD_EXIT 386
-#define _COMPARE_OP 387
-#define _COMPARE_OP_FLOAT 388
-#define _COMPARE_OP_INT 389
-#define _COMPARE_OP_STR 390
-#define _CONTAINS_OP 391
-#define _CONTAINS_OP_DICT 392
-#define _CONTAINS_OP_SET 393
+#define _CHECK_FUNCTION_EXACT_ARGS 374
+#define _CHECK_FUNCTION_VERSION 375
+#define _CHECK_FUNCTION_VERSION_INLINE 376
+#define _CHECK_FUNCTION_VERSION_KW 377
+#define _CHECK_IS_NOT_PY_CALLABLE 378
+#define _CHECK_IS_NOT_PY_CALLABLE_EX 379
+#define _CHECK_IS_NOT_PY_CALLABLE_KW 380
+#define _CHECK_IS_PY_CALLABLE_EX 381
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES 382
+#define _CHECK_METHOD_VERSION 383
+#define _CHECK_METHOD_VERSION_KW 384
+#define _CHECK_OBJECT 385
+#define _CHECK_PEP_523 386
+#define _CHECK_PERIODIC 387
+#define _CHECK_PERIODIC_AT_END 388
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 389
+#define _CHECK_RECURSION_LIMIT 390
+#define _CHECK_RECURSION_REMAINING 391
+#define _CHECK_STACK_SPACE 392
+#define _CHECK_STACK_SPACE_OPERAND 393
+#define _CHECK_VALIDITY 394
+#define _COLD_DYNAMIC_EXIT 395
+#define _COLD_EXIT 396
+#define _COMPARE_OP 397
+#define _COMPARE_OP_FLOAT 398
+#define _COMPARE_OP_INT 399
+#define _COMPARE_OP_STR 400
+#define _CONTAINS_OP 401
+#define _CONTAINS_OP_DICT 402
+#define _CONTAINS_OP_SET 403
 #define _CONVERT_VALUE CONVERT_VALUE
-#define _COPY 394
-#define _COPY_1 395
-#define _COPY_2 396
-#define _COPY_3 397
+#define _COPY 404
+#define _COPY_1 405
+#define _COPY_2 406
+#define _COPY_3 407
 #define _COPY_FREE_VARS COPY_FREE_VARS
-#define _CREATE_INIT_FRAME 398
+#define _CREATE_INIT_FRAME 408
 #define _DELETE_ATTR DELETE_ATTR
 #define _DELETE_DEREF DELETE_DEREF
 #define _DELETE_FAST DELETE_FAST
 #define _DELETE_GLOBAL DELETE_GLOBAL
 #define _DELETE_NAME DELETE_NAME
 #define _DELETE_SUBSCR DELETE_SUBSCR
-#define _DEOPT 399
-#define _DICT_MERGE 400
-#define _DICT_UPDATE 401
-#define _DO_CALL 402
-#define _DO_CALL_FUNCTION_EX 403
-#define _DO_CALL_KW 404
-#define _DYNAMIC_EXIT 405
+#define _DEOPT 409
+#define _DICT_MERGE 410
+#define _DICT_UPDATE 411
+#define _DO_CALL 412
+#define _DO_CALL_FUNCTION_EX 413
+#define _DO_CALL_KW 414
+#define _DYNAMIC_EXIT 415
 #define _END_FOR END_FOR
 #define _END_SEND END_SEND
-#define _ERROR_POP_N 406
+#define _ERROR_POP_N 416
 #define _EXIT_INIT_CHECK EXIT_INIT_CHECK
-#define _EXPAND_METHOD 407
-#define _EXPAND_METHOD_KW 408
-#define _FATAL_ERROR 409
+#define _EXPAND_METHOD 417
+#define _EXPAND_METHOD_KW 418
+#define _FATAL_ERROR 419
 #define _FORMAT_SIMPLE FORMAT_SIMPLE
 #define _FORMAT_WITH_SPEC FORMAT_WITH_SPEC
-#define _FOR_ITER 410
-#define _FOR_ITER_GEN_FRAME 411
-#define _FOR_ITER_TIER_TWO 412
-#define _FOR_ITER_VIRTUAL 413
-#define _FOR_ITER_VIRTUAL_TIER_TWO 414
+#define _FOR_ITER 420
+#define _FOR_ITER_GEN_FRAME 421
+#define _FOR_ITER_TIER_TWO 422
+#define _FOR_ITER_VIRTUAL 423
+#define _FOR_ITER_VIRTUAL_TIER_TWO 424
 #define _GET_AITER GET_AITER
 #define _GET_ANEXT GET_ANEXT
 #define _GET_AWAITABLE GET_AWAITABLE
-#define _GET_ITER 415
-#define _GET_ITER_TRAD 416
+#define _GET_ITER 425
+#define _GET_ITER_TRAD 426
 #define _GET_LEN GET_LEN
-#define _GUARD_3OS_ASYNC_GEN_ASEND 417
-#define _GUARD_BINARY_OP_EXTEND 418
-#define _GUARD_BINARY_OP_EXTEND_LHS 419
-#define _GUARD_BINARY_OP_EXTEND_RHS 420
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS 421
-#define _GUARD_BIT_IS_SET_POP 422
-#define _GUARD_BIT_IS_SET_POP_4 423
-#define _GUARD_BIT_IS_SET_POP_5 424
-#define _GUARD_BIT_IS_SET_POP_6 425
-#define _GUARD_BIT_IS_SET_POP_7 426
-#define _GUARD_BIT_IS_UNSET_POP 427
-#define _GUARD_BIT_IS_UNSET_POP_4 428
-#define _GUARD_BIT_IS_UNSET_POP_5 429
-#define _GUARD_BIT_IS_UNSET_POP_6 430
-#define _GUARD_BIT_IS_UNSET_POP_7 431
-#define _GUARD_CALLABLE_BUILTIN_CLASS 432
-#define _GUARD_CALLABLE_BUILTIN_FAST 433
-#define _GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS 434
-#define _GUARD_CALLABLE_BUILTIN_O 435
-#define _GUARD_CALLABLE_ISINSTANCE 436
-#define _GUARD_CALLABLE_LEN 437
-#define _GUARD_CALLABLE_LIST_APPEND 438
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST 439
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 440
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_NOARGS 441
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_O 442
-#define _GUARD_CALLABLE_STR_1 443
-#define _GUARD_CALLABLE_TUPLE_1 444
-#define _GUARD_CALLABLE_TYPE_1 445
-#define _GUARD_CODE_VERSION_RETURN_GENERATOR 446
-#define _GUARD_CODE_VERSION_RETURN_VALUE 447
-#define _GUARD_CODE_VERSION_YIELD_VALUE 448
-#define _GUARD_CODE_VERSION__PUSH_FRAME 449
-#define _GUARD_DORV_NO_DICT 450
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 451
-#define _GUARD_GLOBALS_VERSION 452
-#define _GUARD_IP_RETURN_GENERATOR 453
-#define _GUARD_IP_RETURN_VALUE 454
-#define _GUARD_IP_YIELD_VALUE 455
-#define _GUARD_IP__PUSH_FRAME 456
-#define _GUARD_IS_FALSE_POP 457
-#define _GUARD_IS_NONE_POP 458
-#define _GUARD_IS_NOT_NONE_POP 459
-#define _GUARD_IS_TRUE_POP 460
-#define _GUARD_ITERATOR 461
-#define _GUARD_ITER_VIRTUAL 462
-#define _GUARD_KEYS_VERSION 463
-#define _GUARD_LOAD_SUPER_ATTR_METHOD 464
-#define _GUARD_NOS_COMPACT_ASCII 465
-#define _GUARD_NOS_DICT_STORE_SUBSCRIPT 466
-#define _GUARD_NOS_DICT_SUBSCRIPT 467
-#define _GUARD_NOS_FLOAT 468
-#define _GUARD_NOS_INT 469
-#define _GUARD_NOS_ITER_VIRTUAL 470
-#define _GUARD_NOS_LIST 471
-#define _GUARD_NOS_NOT_NULL 472
-#define _GUARD_NOS_NULL 473
-#define _GUARD_NOS_OVERFLOWED 474
-#define _GUARD_NOS_TUPLE 475
-#define _GUARD_NOS_TYPE_VERSION 476
-#define _GUARD_NOS_UNICODE 477
-#define _GUARD_NOT_EXHAUSTED_LIST 478
-#define _GUARD_NOT_EXHAUSTED_RANGE 479
-#define _GUARD_NOT_EXHAUSTED_TUPLE 480
-#define _GUARD_THIRD_NULL 481
-#define _GUARD_TOS_ANY_DICT 482
-#define _GUARD_TOS_ANY_SET 483
-#define _GUARD_TOS_DICT 484
-#define _GUARD_TOS_FLOAT 485
-#define _GUARD_TOS_FROZENDICT 486
-#define _GUARD_TOS_FROZENSET 487
-#define _GUARD_TOS_INT 488
-#define _GUARD_TOS_IS_NONE 489
-#define _GUARD_TOS_LIST 490
-#define _GUARD_TOS_NOT_NULL 491
-#define _GUARD_TOS_OVERFLOWED 492
-#define _GUARD_TOS_SET 493
-#define _GUARD_TOS_SLICE 494
-#define _GUARD_TOS_TUPLE 495
-#define _GUARD_TOS_UNICODE 496
-#define _GUARD_TYPE 497
-#define _GUARD_TYPE_ITER 498
-#define _GUARD_TYPE_VERSION 499
-#define _GUARD_TYPE_VERSION_LOCKED 500
-#define _HANDLE_PENDING_AND_DEOPT 501
+#define _GUARD_3OS_ASYNC_GEN_ASEND 427
+#define _GUARD_BINARY_OP_EXTEND 428
+#define _GUARD_BINARY_OP_EXTEND_LHS 429
+#define _GUARD_BINARY_OP_EXTEND_RHS 430
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS 431
+#define _GUARD_BIT_IS_SET_POP 432
+#define _GUARD_BIT_IS_SET_POP_4 433
+#define _GUARD_BIT_IS_SET_POP_5 434
+#define _GUARD_BIT_IS_SET_POP_6 435
+#define _GUARD_BIT_IS_SET_POP_7 436
+#define _GUARD_BIT_IS_UNSET_POP 437
+#define _GUARD_BIT_IS_UNSET_POP_4 438
+#define _GUARD_BIT_IS_UNSET_POP_5 439
+#define _GUARD_BIT_IS_UNSET_POP_6 440
+#define _GUARD_BIT_IS_UNSET_POP_7 441
+#define _GUARD_CALLABLE_BUILTIN_CLASS 442
+#define _GUARD_CALLABLE_BUILTIN_CLASS_KW 443
+#define _GUARD_CALLABLE_BUILTIN_FAST 444
+#define _GUARD_CALLABLE_BUILTIN_FAST_KW 445
+#define _GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS 446
+#define _GUARD_CALLABLE_BUILTIN_O 447
+#define _GUARD_CALLABLE_ISINSTANCE 448
+#define _GUARD_CALLABLE_LEN 449
+#define _GUARD_CALLABLE_LIST_APPEND 450
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST 451
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW 452
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 453
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_NOARGS 454
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_O 455
+#define _GUARD_CALLABLE_STR_1 456
+#define _GUARD_CALLABLE_TUPLE_1 457
+#define _GUARD_CALLABLE_TYPE_1 458
+#define _GUARD_CODE_VERSION_RETURN_GENERATOR 459
+#define _GUARD_CODE_VERSION_RETURN_VALUE 460
+#define _GUARD_CODE_VERSION_YIELD_VALUE 461
+#define _GUARD_CODE_VERSION__PUSH_FRAME 462
+#define _GUARD_DORV_NO_DICT 463
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 464
+#define _GUARD_GLOBALS_VERSION 465
+#define _GUARD_IP_RETURN_GENERATOR 466
+#define _GUARD_IP_RETURN_VALUE 467
+#define _GUARD_IP_YIELD_VALUE 468
+#define _GUARD_IP__PUSH_FRAME 469
+#define _GUARD_IS_FALSE_POP 470
+#define _GUARD_IS_NONE_POP 471
+#define _GUARD_IS_NOT_NONE_POP 472
+#define _GUARD_IS_TRUE_POP 473
+#define _GUARD_ITERATOR 474
+#define _GUARD_ITER_VIRTUAL 475
+#define _GUARD_KEYS_VERSION 476
+#define _GUARD_LOAD_SUPER_ATTR_METHOD 477
+#define _GUARD_NOS_COMPACT_ASCII 478
+#define _GUARD_NOS_DICT_STORE_SUBSCRIPT 479
+#define _GUARD_NOS_DICT_SUBSCRIPT 480
+#define _GUARD_NOS_FLOAT 481
+#define _GUARD_NOS_INT 482
+#define _GUARD_NOS_ITER_VIRTUAL 483
+#define _GUARD_NOS_LIST 484
+#define _GUARD_NOS_NOT_NULL 485
+#define _GUARD_NOS_NULL 486
+#define _GUARD_NOS_OVERFLOWED 487
+#define _GUARD_NOS_TUPLE 488
+#define _GUARD_NOS_TYPE_VERSION 489
+#define _GUARD_NOS_UNICODE 490
+#define _GUARD_NOT_EXHAUSTED_LIST 491
+#define _GUARD_NOT_EXHAUSTED_RANGE 492
+#define _GUARD_NOT_EXHAUSTED_TUPLE 493
+#define _GUARD_THIRD_NULL 494
+#define _GUARD_TOS_ANY_DICT 495
+#define _GUARD_TOS_ANY_SET 496
+#define _GUARD_TOS_DICT 497
+#define _GUARD_TOS_FLOAT 498
+#define _GUARD_TOS_FROZENDICT 499
+#define _GUARD_TOS_FROZENSET 500
+#define _GUARD_TOS_INT 501
+#define _GUARD_TOS_IS_NONE 502
+#define _GUARD_TOS_LIST 503
+#define _GUARD_TOS_NOT_NULL 504
+#define _GUARD_TOS_OVERFLOWED 505
+#define _GUARD_TOS_SET 506
+#define _GUARD_TOS_SLICE 507
+#define _GUARD_TOS_TUPLE 508
+#define _GUARD_TOS_UNICODE 509
+#define _GUARD_TYPE 510
+#define _GUARD_TYPE_ITER 511
+#define _GUARD_TYPE_VERSION 512
+#define _GUARD_TYPE_VERSION_LOCKED 513
+#define _HANDLE_PENDING_AND_DEOPT 514
 #define _IMPORT_FROM IMPORT_FROM
 #define _IMPORT_NAME IMPORT_NAME
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 502
-#define _INIT_CALL_PY_EXACT_ARGS 503
-#define _INIT_CALL_PY_EXACT_ARGS_0 504
-#define _INIT_CALL_PY_EXACT_ARGS_1 505
-#define _INIT_CALL_PY_EXACT_ARGS_2 506
-#define _INIT_CALL_PY_EXACT_ARGS_3 507
-#define _INIT_CALL_PY_EXACT_ARGS_4 508
-#define _INSERT_NULL 509
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 515
+#define _INIT_CALL_PY_EXACT_ARGS 516
+#define _INIT_CALL_PY_EXACT_ARGS_0 517
+#define _INIT_CALL_PY_EXACT_ARGS_1 518
+#define _INIT_CALL_PY_EXACT_ARGS_2 519
+#define _INIT_CALL_PY_EXACT_ARGS_3 520
+#define _INIT_CALL_PY_EXACT_ARGS_4 521
+#define _INSERT_NULL 522
 #define _INSTRUMENTED_FOR_ITER INSTRUMENTED_FOR_ITER
 #define _INSTRUMENTED_INSTRUCTION INSTRUMENTED_INSTRUCTION
 #define _INSTRUMENTED_JUMP_FORWARD INSTRUMENTED_JUMP_FORWARD
@@ -257,1194 +270,1221 @@ extern "C" {
 #define _INSTRUMENTED_POP_JUMP_IF_NONE INSTRUMENTED_POP_JUMP_IF_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE INSTRUMENTED_POP_JUMP_IF_NOT_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_TRUE INSTRUMENTED_POP_JUMP_IF_TRUE
-#define _IS_NONE 510
-#define _IS_OP 511
-#define _ITER_CHECK_LIST 512
-#define _ITER_CHECK_RANGE 513
-#define _ITER_CHECK_TUPLE 514
-#define _ITER_JUMP_LIST 515
-#define _ITER_JUMP_RANGE 516
-#define _ITER_JUMP_TUPLE 517
-#define _ITER_NEXT_INLINE 518
-#define _ITER_NEXT_LIST 519
-#define _ITER_NEXT_LIST_TIER_TWO 520
-#define _ITER_NEXT_RANGE 521
-#define _ITER_NEXT_TUPLE 522
+#define _IS_NONE 523
+#define _IS_OP 524
+#define _ITER_CHECK_LIST 525
+#define _ITER_CHECK_RANGE 526
+#define _ITER_CHECK_TUPLE 527
+#define _ITER_JUMP_LIST 528
+#define _ITER_JUMP_RANGE 529
+#define _ITER_JUMP_TUPLE 530
+#define _ITER_NEXT_INLINE 531
+#define _ITER_NEXT_LIST 532
+#define _ITER_NEXT_LIST_TIER_TWO 533
+#define _ITER_NEXT_RANGE 534
+#define _ITER_NEXT_TUPLE 535
 #define _JUMP_BACKWARD_NO_INTERRUPT JUMP_BACKWARD_NO_INTERRUPT
-#define _JUMP_TO_TOP 523
+#define _JUMP_TO_TOP 536
 #define _LIST_APPEND LIST_APPEND
-#define _LIST_EXTEND 524
-#define _LOAD_ATTR 525
-#define _LOAD_ATTR_CLASS 526
-#define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN_FRAME 527
-#define _LOAD_ATTR_INSTANCE_VALUE 528
-#define _LOAD_ATTR_METHOD_LAZY_DICT 529
-#define _LOAD_ATTR_METHOD_NO_DICT 530
-#define _LOAD_ATTR_METHOD_WITH_VALUES 531
-#define _LOAD_ATTR_MODULE 532
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 533
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 534
-#define _LOAD_ATTR_PROPERTY_FRAME 535
-#define _LOAD_ATTR_SLOT 536
-#define _LOAD_ATTR_WITH_HINT 537
+#define _LIST_EXTEND 537
+#define _LOAD_ATTR 538
+#define _LOAD_ATTR_CLASS 539
+#define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN_FRAME 540
+#define _LOAD_ATTR_INSTANCE_VALUE 541
+#define _LOAD_ATTR_METHOD_LAZY_DICT 542
+#define _LOAD_ATTR_METHOD_NO_DICT 543
+#define _LOAD_ATTR_METHOD_WITH_VALUES 544
+#define _LOAD_ATTR_MODULE 545
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 546
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 547
+#define _LOAD_ATTR_PROPERTY_FRAME 548
+#define _LOAD_ATTR_SLOT 549
+#define _LOAD_ATTR_WITH_HINT 550
 #define _LOAD_BUILD_CLASS LOAD_BUILD_CLASS
-#define _LOAD_BYTECODE 538
+#define _LOAD_BYTECODE 551
 #define _LOAD_COMMON_CONSTANT LOAD_COMMON_CONSTANT
 #define _LOAD_CONST LOAD_CONST
-#define _LOAD_CONST_INLINE 539
-#define _LOAD_CONST_INLINE_BORROW 540
+#define _LOAD_CONST_INLINE 552
+#define _LOAD_CONST_INLINE_BORROW 553
 #define _LOAD_DEREF LOAD_DEREF
-#define _LOAD_FAST 541
-#define _LOAD_FAST_0 542
-#define _LOAD_FAST_1 543
-#define _LOAD_FAST_2 544
-#define _LOAD_FAST_3 545
-#define _LOAD_FAST_4 546
-#define _LOAD_FAST_5 547
-#define _LOAD_FAST_6 548
-#define _LOAD_FAST_7 549
+#define _LOAD_FAST 554
+#define _LOAD_FAST_0 555
+#define _LOAD_FAST_1 556
+#define _LOAD_FAST_2 557
+#define _LOAD_FAST_3 558
+#define _LOAD_FAST_4 559
+#define _LOAD_FAST_5 560
+#define _LOAD_FAST_6 561
+#define _LOAD_FAST_7 562
 #define _LOAD_FAST_AND_CLEAR LOAD_FAST_AND_CLEAR
-#define _LOAD_FAST_BORROW 550
-#define _LOAD_FAST_BORROW_0 551
-#define _LOAD_FAST_BORROW_1 552
-#define _LOAD_FAST_BORROW_2 553
-#define _LOAD_FAST_BORROW_3 554
-#define _LOAD_FAST_BORROW_4 555
-#define _LOAD_FAST_BORROW_5 556
-#define _LOAD_FAST_BORROW_6 557
-#define _LOAD_FAST_BORROW_7 558
+#define _LOAD_FAST_BORROW 563
+#define _LOAD_FAST_BORROW_0 564
+#define _LOAD_FAST_BORROW_1 565
+#define _LOAD_FAST_BORROW_2 566
+#define _LOAD_FAST_BORROW_3 567
+#define _LOAD_FAST_BORROW_4 568
+#define _LOAD_FAST_BORROW_5 569
+#define _LOAD_FAST_BORROW_6 570
+#define _LOAD_FAST_BORROW_7 571
 #define _LOAD_FAST_CHECK LOAD_FAST_CHECK
 #define _LOAD_FROM_DICT_OR_DEREF LOAD_FROM_DICT_OR_DEREF
 #define _LOAD_FROM_DICT_OR_GLOBALS LOAD_FROM_DICT_OR_GLOBALS
-#define _LOAD_GLOBAL 559
-#define _LOAD_GLOBAL_BUILTINS 560
-#define _LOAD_GLOBAL_MODULE 561
+#define _LOAD_GLOBAL 572
+#define _LOAD_GLOBAL_BUILTINS 573
+#define _LOAD_GLOBAL_MODULE 574
 #define _LOAD_LOCALS LOAD_LOCALS
 #define _LOAD_NAME LOAD_NAME
-#define _LOAD_SMALL_INT 562
-#define _LOAD_SMALL_INT_0 563
-#define _LOAD_SMALL_INT_1 564
-#define _LOAD_SMALL_INT_2 565
-#define _LOAD_SMALL_INT_3 566
-#define _LOAD_SPECIAL 567
+#define _LOAD_SMALL_INT 575
+#define _LOAD_SMALL_INT_0 576
+#define _LOAD_SMALL_INT_1 577
+#define _LOAD_SMALL_INT_2 578
+#define _LOAD_SMALL_INT_3 579
+#define _LOAD_SPECIAL 580
 #define _LOAD_SUPER_ATTR_ATTR LOAD_SUPER_ATTR_ATTR
-#define _LOAD_SUPER_ATTR_METHOD 568
-#define _LOCK_OBJECT 569
-#define _MAKE_CALLARGS_A_TUPLE 570
+#define _LOAD_SUPER_ATTR_METHOD 581
+#define _LOCK_OBJECT 582
+#define _LOOP_HEAD 583
+#define _MAKE_CALLARGS_A_TUPLE 584
 #define _MAKE_CELL MAKE_CELL
-#define _MAKE_FUNCTION 571
-#define _MAKE_HEAP_SAFE 572
-#define _MAKE_WARM 573
+#define _MAKE_FUNCTION 585
+#define _MAKE_HEAP_SAFE 586
+#define _MAKE_WARM 587
 #define _MAP_ADD MAP_ADD
-#define _MATCH_CLASS 574
+#define _MATCH_CLASS 588
 #define _MATCH_KEYS MATCH_KEYS
 #define _MATCH_MAPPING MATCH_MAPPING
 #define _MATCH_SEQUENCE MATCH_SEQUENCE
-#define _MAYBE_EXPAND_METHOD 575
-#define _MAYBE_EXPAND_METHOD_KW 576
-#define _MONITOR_CALL 577
-#define _MONITOR_CALL_KW 578
-#define _MONITOR_JUMP_BACKWARD 579
-#define _MONITOR_RESUME 580
+#define _MAYBE_EXPAND_METHOD 589
+#define _MAYBE_EXPAND_METHOD_KW 590
+#define _MONITOR_CALL 591
+#define _MONITOR_CALL_KW 592
+#define _MONITOR_JUMP_BACKWARD 593
+#define _MONITOR_RESUME 594
 #define _NOP NOP
 #define _POP_EXCEPT POP_EXCEPT
 #define _POP_ITER POP_ITER
-#define _POP_JUMP_IF_FALSE 581
-#define _POP_JUMP_IF_TRUE 582
+#define _POP_JUMP_IF_FALSE 595
+#define _POP_JUMP_IF_TRUE 596
 #define _POP_TOP POP_TOP
-#define _POP_TOP_FLOAT 583
-#define _POP_TOP_INT 584
-#define _POP_TOP_NOP 585
-#define _POP_TOP_OPARG 586
-#define _POP_TOP_UNICODE 587
+#define _POP_TOP_FLOAT 597
+#define _POP_TOP_INT 598
+#define _POP_TOP_NOP 599
+#define _POP_TOP_OPARG 600
+#define _POP_TOP_UNICODE 601
 #define _PUSH_EXC_INFO PUSH_EXC_INFO
-#define _PUSH_FRAME 588
+#define _PUSH_FRAME 602
 #define _PUSH_NULL PUSH_NULL
-#define _PUSH_NULL_CONDITIONAL 589
-#define _PUSH_TAGGED_ZERO 590
-#define _PY_FRAME_EX 591
-#define _PY_FRAME_GENERAL 592
-#define _PY_FRAME_KW 593
-#define _RECORD_3OS_GEN_FUNC 594
-#define _RECORD_4OS 595
-#define _RECORD_BOUND_METHOD 596
-#define _RECORD_CALLABLE 597
-#define _RECORD_CALLABLE_KW 598
-#define _RECORD_CODE 599
-#define _RECORD_NOS 600
-#define _RECORD_NOS_GEN_FUNC 601
-#define _RECORD_NOS_TYPE 602
-#define _RECORD_TOS 603
-#define _RECORD_TOS_TYPE 604
-#define _REPLACE_WITH_TRUE 605
-#define _RESUME_CHECK 606
+#define _PUSH_NULL_CONDITIONAL 603
+#define _PUSH_TAGGED_ZERO 604
+#define _PY_FRAME_EX 605
+#define _PY_FRAME_GENERAL 606
+#define _PY_FRAME_KW 607
+#define _RECORD_3OS_GEN_FUNC 608
+#define _RECORD_4OS 609
+#define _RECORD_BOUND_METHOD 610
+#define _RECORD_CALLABLE 611
+#define _RECORD_CALLABLE_KW 612
+#define _RECORD_CODE 613
+#define _RECORD_NOS 614
+#define _RECORD_NOS_GEN_FUNC 615
+#define _RECORD_NOS_TYPE 616
+#define _RECORD_TOS 617
+#define _RECORD_TOS_TYPE 618
+#define _REPLACE_WITH_TRUE 619
+#define _RESUME_CHECK 620
 #define _RETURN_GENERATOR RETURN_GENERATOR
-#define _RETURN_VALUE 607
-#define _RROT_3 608
-#define _SAVE_RETURN_OFFSET 609
-#define _SEND_ASYNC_GEN 610
-#define _SEND_ASYNC_GEN_TIER_TWO 611
-#define _SEND_GEN_FRAME 612
-#define _SEND_VIRTUAL 613
-#define _SEND_VIRTUAL_TIER_TWO 614
+#define _RETURN_VALUE 621
+#define _RROT_3 622
+#define _SAVE_RETURN_OFFSET 623
+#define _SEND_ASYNC_GEN 624
+#define _SEND_ASYNC_GEN_TIER_TWO 625
+#define _SEND_GEN_FRAME 626
+#define _SEND_VIRTUAL 627
+#define _SEND_VIRTUAL_TIER_TWO 628
 #define _SETUP_ANNOTATIONS SETUP_ANNOTATIONS
 #define _SET_ADD SET_ADD
 #define _SET_FUNCTION_ATTRIBUTE SET_FUNCTION_ATTRIBUTE
-#define _SET_UPDATE 615
-#define _SPILL_OR_RELOAD 616
-#define _START_EXECUTOR 617
-#define _STORE_ATTR 618
-#define _STORE_ATTR_INSTANCE_VALUE 619
-#define _STORE_ATTR_SLOT 620
-#define _STORE_ATTR_WITH_HINT 621
+#define _SET_UPDATE 629
+#define _SPILL_OR_RELOAD 630
+#define _START_EXECUTOR 631
+#define _STORE_ATTR 632
+#define _STORE_ATTR_INSTANCE_VALUE 633
+#define _STORE_ATTR_SLOT 634
+#define _STORE_ATTR_WITH_HINT 635
 #define _STORE_DEREF STORE_DEREF
 #define _STORE_GLOBAL STORE_GLOBAL
 #define _STORE_NAME STORE_NAME
-#define _STORE_SLICE 622
-#define _STORE_SUBSCR 623
-#define _STORE_SUBSCR_DICT 624
-#define _STORE_SUBSCR_DICT_KNOWN_HASH 625
-#define _STORE_SUBSCR_LIST_INT 626
-#define _SWAP 627
-#define _SWAP_2 628
-#define _SWAP_3 629
-#define _SWAP_FAST 630
-#define _SWAP_FAST_0 631
-#define _SWAP_FAST_1 632
-#define _SWAP_FAST_2 633
-#define _SWAP_FAST_3 634
-#define _SWAP_FAST_4 635
-#define _SWAP_FAST_5 636
-#define _SWAP_FAST_6 637
-#define _SWAP_FAST_7 638
-#define _TIER2_RESUME_CHECK 639
-#define _TO_BOOL 640
+#define _STORE_SLICE 636
+#define _STORE_SUBSCR 637
+#define _STORE_SUBSCR_DICT 638
+#define _STORE_SUBSCR_DICT_KNOWN_HASH 639
+#define _STORE_SUBSCR_LIST_INT 640
+#define _SWAP 641
+#define _SWAP_2 642
+#define _SWAP_3 643
+#define _SWAP_FAST 644
+#define _SWAP_FAST_0 645
+#define _SWAP_FAST_1 646
+#define _SWAP_FAST_2 647
+#define _SWAP_FAST_3 648
+#define _SWAP_FAST_4 649
+#define _SWAP_FAST_5 650
+#define _SWAP_FAST_6 651
+#define _SWAP_FAST_7 652
+#define _TIER2_RESUME_CHECK 653
+#define _TO_BOOL 654
 #define _TO_BOOL_BOOL TO_BOOL_BOOL
-#define _TO_BOOL_INT 641
-#define _TO_BOOL_LIST 642
+#define _TO_BOOL_INT 655
+#define _TO_BOOL_LIST 656
 #define _TO_BOOL_NONE TO_BOOL_NONE
-#define _TO_BOOL_STR 643
+#define _TO_BOOL_STR 657
 #define _TRACE_RECORD TRACE_RECORD
-#define _UNARY_INVERT 644
-#define _UNARY_NEGATIVE 645
-#define _UNARY_NEGATIVE_FLOAT_INPLACE 646
+#define _UNARY_INVERT 658
+#define _UNARY_NEGATIVE 659
+#define _UNARY_NEGATIVE_FLOAT_INPLACE 660
 #define _UNARY_NOT UNARY_NOT
 #define _UNPACK_EX UNPACK_EX
-#define _UNPACK_SEQUENCE 647
-#define _UNPACK_SEQUENCE_LIST 648
-#define _UNPACK_SEQUENCE_TUPLE 649
-#define _UNPACK_SEQUENCE_TWO_TUPLE 650
-#define _UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE 651
-#define _UNPACK_SEQUENCE_UNIQUE_TUPLE 652
-#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE 653
+#define _UNPACK_SEQUENCE 661
+#define _UNPACK_SEQUENCE_LIST 662
+#define _UNPACK_SEQUENCE_TUPLE 663
+#define _UNPACK_SEQUENCE_TWO_TUPLE 664
+#define _UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE 665
+#define _UNPACK_SEQUENCE_UNIQUE_TUPLE 666
+#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE 667
 #define _WITH_EXCEPT_START WITH_EXCEPT_START
-#define _YIELD_VALUE 654
-#define MAX_UOP_ID 654
-#define _ALLOCATE_OBJECT_r00 655
-#define _BINARY_OP_r23 656
-#define _BINARY_OP_ADD_FLOAT_r03 657
-#define _BINARY_OP_ADD_FLOAT_r13 658
-#define _BINARY_OP_ADD_FLOAT_r23 659
-#define _BINARY_OP_ADD_FLOAT_INPLACE_r03 660
-#define _BINARY_OP_ADD_FLOAT_INPLACE_r13 661
-#define _BINARY_OP_ADD_FLOAT_INPLACE_r23 662
-#define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r03 663
-#define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r13 664
-#define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r23 665
-#define _BINARY_OP_ADD_INT_r03 666
-#define _BINARY_OP_ADD_INT_r13 667
-#define _BINARY_OP_ADD_INT_r23 668
-#define _BINARY_OP_ADD_INT_INPLACE_r03 669
-#define _BINARY_OP_ADD_INT_INPLACE_r13 670
-#define _BINARY_OP_ADD_INT_INPLACE_r23 671
-#define _BINARY_OP_ADD_INT_INPLACE_RIGHT_r03 672
-#define _BINARY_OP_ADD_INT_INPLACE_RIGHT_r13 673
-#define _BINARY_OP_ADD_INT_INPLACE_RIGHT_r23 674
-#define _BINARY_OP_ADD_UNICODE_r03 675
-#define _BINARY_OP_ADD_UNICODE_r13 676
-#define _BINARY_OP_ADD_UNICODE_r23 677
-#define _BINARY_OP_EXTEND_r23 678
-#define _BINARY_OP_INPLACE_ADD_UNICODE_r21 679
-#define _BINARY_OP_MULTIPLY_FLOAT_r03 680
-#define _BINARY_OP_MULTIPLY_FLOAT_r13 681
-#define _BINARY_OP_MULTIPLY_FLOAT_r23 682
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r03 683
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r13 684
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23 685
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r03 686
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r13 687
-#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r23 688
-#define _BINARY_OP_MULTIPLY_INT_r03 689
-#define _BINARY_OP_MULTIPLY_INT_r13 690
-#define _BINARY_OP_MULTIPLY_INT_r23 691
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_r03 692
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_r13 693
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_r23 694
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT_r03 695
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT_r13 696
-#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT_r23 697
-#define _BINARY_OP_SUBSCR_CHECK_FUNC_r23 698
-#define _BINARY_OP_SUBSCR_DICT_r23 699
-#define _BINARY_OP_SUBSCR_DICT_KNOWN_HASH_r23 700
-#define _BINARY_OP_SUBSCR_INIT_CALL_r01 701
-#define _BINARY_OP_SUBSCR_INIT_CALL_r11 702
-#define _BINARY_OP_SUBSCR_INIT_CALL_r21 703
-#define _BINARY_OP_SUBSCR_INIT_CALL_r31 704
-#define _BINARY_OP_SUBSCR_LIST_INT_r23 705
-#define _BINARY_OP_SUBSCR_LIST_SLICE_r23 706
-#define _BINARY_OP_SUBSCR_STR_INT_r23 707
-#define _BINARY_OP_SUBSCR_TUPLE_INT_r03 708
-#define _BINARY_OP_SUBSCR_TUPLE_INT_r13 709
-#define _BINARY_OP_SUBSCR_TUPLE_INT_r23 710
-#define _BINARY_OP_SUBSCR_USTR_INT_r23 711
-#define _BINARY_OP_SUBTRACT_FLOAT_r03 712
-#define _BINARY_OP_SUBTRACT_FLOAT_r13 713
-#define _BINARY_OP_SUBTRACT_FLOAT_r23 714
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r03 715
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r13 716
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23 717
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r03 718
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r13 719
-#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r23 720
-#define _BINARY_OP_SUBTRACT_INT_r03 721
-#define _BINARY_OP_SUBTRACT_INT_r13 722
-#define _BINARY_OP_SUBTRACT_INT_r23 723
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_r03 724
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_r13 725
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_r23 726
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT_r03 727
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT_r13 728
-#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT_r23 729
-#define _BINARY_OP_TRUEDIV_FLOAT_r23 730
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_r03 731
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_r13 732
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_r23 733
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r03 734
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r13 735
-#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r23 736
-#define _BINARY_SLICE_r31 737
-#define _BUILD_INTERPOLATION_r01 738
-#define _BUILD_LIST_r01 739
-#define _BUILD_MAP_r01 740
-#define _BUILD_SET_r01 741
-#define _BUILD_SLICE_r01 742
-#define _BUILD_STRING_r01 743
-#define _BUILD_TEMPLATE_r21 744
-#define _BUILD_TUPLE_r01 745
-#define _CALL_BUILTIN_CLASS_r00 746
-#define _CALL_BUILTIN_FAST_r00 747
-#define _CALL_BUILTIN_FAST_WITH_KEYWORDS_r00 748
-#define _CALL_BUILTIN_O_r03 749
-#define _CALL_FUNCTION_EX_NON_PY_GENERAL_r31 750
-#define _CALL_INTRINSIC_1_r12 751
-#define _CALL_INTRINSIC_2_r23 752
-#define _CALL_ISINSTANCE_r31 753
-#define _CALL_KW_NON_PY_r11 754
-#define _CALL_LEN_r33 755
-#define _CALL_LIST_APPEND_r03 756
-#define _CALL_LIST_APPEND_r13 757
-#define _CALL_LIST_APPEND_r23 758
-#define _CALL_LIST_APPEND_r33 759
-#define _CALL_METHOD_DESCRIPTOR_FAST_r00 760
-#define _CALL_METHOD_DESCRIPTOR_FAST_INLINE_r00 761
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r00 762
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_INLINE_r00 763
-#define _CALL_METHOD_DESCRIPTOR_NOARGS_r03 764
-#define _CALL_METHOD_DESCRIPTOR_NOARGS_INLINE_r03 765
-#define _CALL_METHOD_DESCRIPTOR_O_r03 766
-#define _CALL_METHOD_DESCRIPTOR_O_INLINE_r03 767
-#define _CALL_NON_PY_GENERAL_r01 768
-#define _CALL_STR_1_r32 769
-#define _CALL_TUPLE_1_r32 770
-#define _CALL_TYPE_1_r02 771
-#define _CALL_TYPE_1_r12 772
-#define _CALL_TYPE_1_r22 773
-#define _CALL_TYPE_1_r32 774
-#define _CHECK_ATTR_CLASS_r01 775
-#define _CHECK_ATTR_CLASS_r11 776
-#define _CHECK_ATTR_CLASS_r22 777
-#define _CHECK_ATTR_CLASS_r33 778
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r01 779
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r11 780
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r22 781
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r33 782
-#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS_r00 783
-#define _CHECK_EG_MATCH_r22 784
-#define _CHECK_EXC_MATCH_r22 785
-#define _CHECK_FUNCTION_EXACT_ARGS_r00 786
-#define _CHECK_FUNCTION_VERSION_r00 787
-#define _CHECK_FUNCTION_VERSION_INLINE_r00 788
-#define _CHECK_FUNCTION_VERSION_INLINE_r11 789
-#define _CHECK_FUNCTION_VERSION_INLINE_r22 790
-#define _CHECK_FUNCTION_VERSION_INLINE_r33 791
-#define _CHECK_FUNCTION_VERSION_KW_r11 792
-#define _CHECK_IS_NOT_PY_CALLABLE_r00 793
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r03 794
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r13 795
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r23 796
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r33 797
-#define _CHECK_IS_NOT_PY_CALLABLE_KW_r11 798
-#define _CHECK_IS_PY_CALLABLE_EX_r03 799
-#define _CHECK_IS_PY_CALLABLE_EX_r13 800
-#define _CHECK_IS_PY_CALLABLE_EX_r23 801
-#define _CHECK_IS_PY_CALLABLE_EX_r33 802
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r01 803
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r11 804
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r22 805
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r33 806
-#define _CHECK_METHOD_VERSION_r00 807
-#define _CHECK_METHOD_VERSION_KW_r11 808
-#define _CHECK_OBJECT_r00 809
-#define _CHECK_PEP_523_r00 810
-#define _CHECK_PEP_523_r11 811
-#define _CHECK_PEP_523_r22 812
-#define _CHECK_PEP_523_r33 813
-#define _CHECK_PERIODIC_r00 814
-#define _CHECK_PERIODIC_AT_END_r00 815
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00 816
-#define _CHECK_RECURSION_LIMIT_r00 817
-#define _CHECK_RECURSION_LIMIT_r11 818
-#define _CHECK_RECURSION_LIMIT_r22 819
-#define _CHECK_RECURSION_LIMIT_r33 820
-#define _CHECK_RECURSION_REMAINING_r00 821
-#define _CHECK_RECURSION_REMAINING_r11 822
-#define _CHECK_RECURSION_REMAINING_r22 823
-#define _CHECK_RECURSION_REMAINING_r33 824
-#define _CHECK_STACK_SPACE_r00 825
-#define _CHECK_STACK_SPACE_OPERAND_r00 826
-#define _CHECK_STACK_SPACE_OPERAND_r11 827
-#define _CHECK_STACK_SPACE_OPERAND_r22 828
-#define _CHECK_STACK_SPACE_OPERAND_r33 829
-#define _CHECK_VALIDITY_r00 830
-#define _CHECK_VALIDITY_r11 831
-#define _CHECK_VALIDITY_r22 832
-#define _CHECK_VALIDITY_r33 833
-#define _COLD_DYNAMIC_EXIT_r00 834
-#define _COLD_EXIT_r00 835
-#define _COMPARE_OP_r21 836
-#define _COMPARE_OP_FLOAT_r03 837
-#define _COMPARE_OP_FLOAT_r13 838
-#define _COMPARE_OP_FLOAT_r23 839
-#define _COMPARE_OP_INT_r23 840
-#define _COMPARE_OP_STR_r23 841
-#define _CONTAINS_OP_r23 842
-#define _CONTAINS_OP_DICT_r23 843
-#define _CONTAINS_OP_SET_r23 844
-#define _CONVERT_VALUE_r11 845
-#define _COPY_r01 846
-#define _COPY_1_r02 847
-#define _COPY_1_r12 848
-#define _COPY_1_r23 849
-#define _COPY_2_r03 850
-#define _COPY_2_r13 851
-#define _COPY_2_r23 852
-#define _COPY_3_r03 853
-#define _COPY_3_r13 854
-#define _COPY_3_r23 855
-#define _COPY_3_r33 856
-#define _COPY_FREE_VARS_r00 857
-#define _COPY_FREE_VARS_r11 858
-#define _COPY_FREE_VARS_r22 859
-#define _COPY_FREE_VARS_r33 860
-#define _CREATE_INIT_FRAME_r01 861
-#define _DELETE_ATTR_r10 862
-#define _DELETE_DEREF_r00 863
-#define _DELETE_FAST_r00 864
-#define _DELETE_GLOBAL_r00 865
-#define _DELETE_NAME_r00 866
-#define _DELETE_SUBSCR_r20 867
-#define _DEOPT_r00 868
-#define _DEOPT_r10 869
-#define _DEOPT_r20 870
-#define _DEOPT_r30 871
-#define _DICT_MERGE_r11 872
-#define _DICT_UPDATE_r11 873
-#define _DO_CALL_r01 874
-#define _DO_CALL_FUNCTION_EX_r31 875
-#define _DO_CALL_KW_r11 876
-#define _DYNAMIC_EXIT_r00 877
-#define _DYNAMIC_EXIT_r10 878
-#define _DYNAMIC_EXIT_r20 879
-#define _DYNAMIC_EXIT_r30 880
-#define _END_FOR_r10 881
-#define _END_SEND_r31 882
-#define _ERROR_POP_N_r00 883
-#define _EXIT_INIT_CHECK_r10 884
-#define _EXIT_TRACE_r00 885
-#define _EXIT_TRACE_r10 886
-#define _EXIT_TRACE_r20 887
-#define _EXIT_TRACE_r30 888
-#define _EXPAND_METHOD_r00 889
-#define _EXPAND_METHOD_KW_r11 890
-#define _FATAL_ERROR_r00 891
-#define _FATAL_ERROR_r11 892
-#define _FATAL_ERROR_r22 893
-#define _FATAL_ERROR_r33 894
-#define _FORMAT_SIMPLE_r11 895
-#define _FORMAT_WITH_SPEC_r21 896
-#define _FOR_ITER_r23 897
-#define _FOR_ITER_GEN_FRAME_r03 898
-#define _FOR_ITER_GEN_FRAME_r13 899
-#define _FOR_ITER_GEN_FRAME_r23 900
-#define _FOR_ITER_TIER_TWO_r23 901
-#define _FOR_ITER_VIRTUAL_r23 902
-#define _FOR_ITER_VIRTUAL_TIER_TWO_r23 903
-#define _GET_AITER_r11 904
-#define _GET_ANEXT_r12 905
-#define _GET_AWAITABLE_r11 906
-#define _GET_ITER_r12 907
-#define _GET_ITER_TRAD_r12 908
-#define _GET_LEN_r12 909
-#define _GUARD_3OS_ASYNC_GEN_ASEND_r03 910
-#define _GUARD_3OS_ASYNC_GEN_ASEND_r13 911
-#define _GUARD_3OS_ASYNC_GEN_ASEND_r23 912
-#define _GUARD_3OS_ASYNC_GEN_ASEND_r33 913
-#define _GUARD_BINARY_OP_EXTEND_r22 914
-#define _GUARD_BINARY_OP_EXTEND_LHS_r02 915
-#define _GUARD_BINARY_OP_EXTEND_LHS_r12 916
-#define _GUARD_BINARY_OP_EXTEND_LHS_r22 917
-#define _GUARD_BINARY_OP_EXTEND_LHS_r33 918
-#define _GUARD_BINARY_OP_EXTEND_RHS_r02 919
-#define _GUARD_BINARY_OP_EXTEND_RHS_r12 920
-#define _GUARD_BINARY_OP_EXTEND_RHS_r22 921
-#define _GUARD_BINARY_OP_EXTEND_RHS_r33 922
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r02 923
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r12 924
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r22 925
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r33 926
-#define _GUARD_BIT_IS_SET_POP_r00 927
-#define _GUARD_BIT_IS_SET_POP_r10 928
-#define _GUARD_BIT_IS_SET_POP_r21 929
-#define _GUARD_BIT_IS_SET_POP_r32 930
-#define _GUARD_BIT_IS_SET_POP_4_r00 931
-#define _GUARD_BIT_IS_SET_POP_4_r10 932
-#define _GUARD_BIT_IS_SET_POP_4_r21 933
-#define _GUARD_BIT_IS_SET_POP_4_r32 934
-#define _GUARD_BIT_IS_SET_POP_5_r00 935
-#define _GUARD_BIT_IS_SET_POP_5_r10 936
-#define _GUARD_BIT_IS_SET_POP_5_r21 937
-#define _GUARD_BIT_IS_SET_POP_5_r32 938
-#define _GUARD_BIT_IS_SET_POP_6_r00 939
-#define _GUARD_BIT_IS_SET_POP_6_r10 940
-#define _GUARD_BIT_IS_SET_POP_6_r21 941
-#define _GUARD_BIT_IS_SET_POP_6_r32 942
-#define _GUARD_BIT_IS_SET_POP_7_r00 943
-#define _GUARD_BIT_IS_SET_POP_7_r10 944
-#define _GUARD_BIT_IS_SET_POP_7_r21 945
-#define _GUARD_BIT_IS_SET_POP_7_r32 946
-#define _GUARD_BIT_IS_UNSET_POP_r00 947
-#define _GUARD_BIT_IS_UNSET_POP_r10 948
-#define _GUARD_BIT_IS_UNSET_POP_r21 949
-#define _GUARD_BIT_IS_UNSET_POP_r32 950
-#define _GUARD_BIT_IS_UNSET_POP_4_r00 951
-#define _GUARD_BIT_IS_UNSET_POP_4_r10 952
-#define _GUARD_BIT_IS_UNSET_POP_4_r21 953
-#define _GUARD_BIT_IS_UNSET_POP_4_r32 954
-#define _GUARD_BIT_IS_UNSET_POP_5_r00 955
-#define _GUARD_BIT_IS_UNSET_POP_5_r10 956
-#define _GUARD_BIT_IS_UNSET_POP_5_r21 957
-#define _GUARD_BIT_IS_UNSET_POP_5_r32 958
-#define _GUARD_BIT_IS_UNSET_POP_6_r00 959
-#define _GUARD_BIT_IS_UNSET_POP_6_r10 960
-#define _GUARD_BIT_IS_UNSET_POP_6_r21 961
-#define _GUARD_BIT_IS_UNSET_POP_6_r32 962
-#define _GUARD_BIT_IS_UNSET_POP_7_r00 963
-#define _GUARD_BIT_IS_UNSET_POP_7_r10 964
-#define _GUARD_BIT_IS_UNSET_POP_7_r21 965
-#define _GUARD_BIT_IS_UNSET_POP_7_r32 966
-#define _GUARD_CALLABLE_BUILTIN_CLASS_r00 967
-#define _GUARD_CALLABLE_BUILTIN_FAST_r00 968
-#define _GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS_r00 969
-#define _GUARD_CALLABLE_BUILTIN_O_r00 970
-#define _GUARD_CALLABLE_ISINSTANCE_r03 971
-#define _GUARD_CALLABLE_ISINSTANCE_r13 972
-#define _GUARD_CALLABLE_ISINSTANCE_r23 973
-#define _GUARD_CALLABLE_ISINSTANCE_r33 974
-#define _GUARD_CALLABLE_LEN_r03 975
-#define _GUARD_CALLABLE_LEN_r13 976
-#define _GUARD_CALLABLE_LEN_r23 977
-#define _GUARD_CALLABLE_LEN_r33 978
-#define _GUARD_CALLABLE_LIST_APPEND_r03 979
-#define _GUARD_CALLABLE_LIST_APPEND_r13 980
-#define _GUARD_CALLABLE_LIST_APPEND_r23 981
-#define _GUARD_CALLABLE_LIST_APPEND_r33 982
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_r00 983
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r00 984
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_NOARGS_r00 985
-#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_O_r00 986
-#define _GUARD_CALLABLE_STR_1_r03 987
-#define _GUARD_CALLABLE_STR_1_r13 988
-#define _GUARD_CALLABLE_STR_1_r23 989
-#define _GUARD_CALLABLE_STR_1_r33 990
-#define _GUARD_CALLABLE_TUPLE_1_r03 991
-#define _GUARD_CALLABLE_TUPLE_1_r13 992
-#define _GUARD_CALLABLE_TUPLE_1_r23 993
-#define _GUARD_CALLABLE_TUPLE_1_r33 994
-#define _GUARD_CALLABLE_TYPE_1_r03 995
-#define _GUARD_CALLABLE_TYPE_1_r13 996
-#define _GUARD_CALLABLE_TYPE_1_r23 997
-#define _GUARD_CALLABLE_TYPE_1_r33 998
-#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r00 999
-#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r11 1000
-#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r22 1001
-#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r33 1002
-#define _GUARD_CODE_VERSION_RETURN_VALUE_r00 1003
-#define _GUARD_CODE_VERSION_RETURN_VALUE_r11 1004
-#define _GUARD_CODE_VERSION_RETURN_VALUE_r22 1005
-#define _GUARD_CODE_VERSION_RETURN_VALUE_r33 1006
-#define _GUARD_CODE_VERSION_YIELD_VALUE_r00 1007
-#define _GUARD_CODE_VERSION_YIELD_VALUE_r11 1008
-#define _GUARD_CODE_VERSION_YIELD_VALUE_r22 1009
-#define _GUARD_CODE_VERSION_YIELD_VALUE_r33 1010
-#define _GUARD_CODE_VERSION__PUSH_FRAME_r00 1011
-#define _GUARD_CODE_VERSION__PUSH_FRAME_r11 1012
-#define _GUARD_CODE_VERSION__PUSH_FRAME_r22 1013
-#define _GUARD_CODE_VERSION__PUSH_FRAME_r33 1014
-#define _GUARD_DORV_NO_DICT_r01 1015
-#define _GUARD_DORV_NO_DICT_r11 1016
-#define _GUARD_DORV_NO_DICT_r22 1017
-#define _GUARD_DORV_NO_DICT_r33 1018
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01 1019
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11 1020
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22 1021
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33 1022
-#define _GUARD_GLOBALS_VERSION_r00 1023
-#define _GUARD_GLOBALS_VERSION_r11 1024
-#define _GUARD_GLOBALS_VERSION_r22 1025
-#define _GUARD_GLOBALS_VERSION_r33 1026
-#define _GUARD_IP_RETURN_GENERATOR_r00 1027
-#define _GUARD_IP_RETURN_GENERATOR_r11 1028
-#define _GUARD_IP_RETURN_GENERATOR_r22 1029
-#define _GUARD_IP_RETURN_GENERATOR_r33 1030
-#define _GUARD_IP_RETURN_VALUE_r00 1031
-#define _GUARD_IP_RETURN_VALUE_r11 1032
-#define _GUARD_IP_RETURN_VALUE_r22 1033
-#define _GUARD_IP_RETURN_VALUE_r33 1034
-#define _GUARD_IP_YIELD_VALUE_r00 1035
-#define _GUARD_IP_YIELD_VALUE_r11 1036
-#define _GUARD_IP_YIELD_VALUE_r22 1037
-#define _GUARD_IP_YIELD_VALUE_r33 1038
-#define _GUARD_IP__PUSH_FRAME_r00 1039
-#define _GUARD_IP__PUSH_FRAME_r11 1040
-#define _GUARD_IP__PUSH_FRAME_r22 1041
-#define _GUARD_IP__PUSH_FRAME_r33 1042
-#define _GUARD_IS_FALSE_POP_r00 1043
-#define _GUARD_IS_FALSE_POP_r10 1044
-#define _GUARD_IS_FALSE_POP_r21 1045
-#define _GUARD_IS_FALSE_POP_r32 1046
-#define _GUARD_IS_NONE_POP_r00 1047
-#define _GUARD_IS_NONE_POP_r10 1048
-#define _GUARD_IS_NONE_POP_r21 1049
-#define _GUARD_IS_NONE_POP_r32 1050
-#define _GUARD_IS_NOT_NONE_POP_r10 1051
-#define _GUARD_IS_TRUE_POP_r00 1052
-#define _GUARD_IS_TRUE_POP_r10 1053
-#define _GUARD_IS_TRUE_POP_r21 1054
-#define _GUARD_IS_TRUE_POP_r32 1055
-#define _GUARD_ITERATOR_r01 1056
-#define _GUARD_ITERATOR_r11 1057
-#define _GUARD_ITERATOR_r22 1058
-#define _GUARD_ITERATOR_r33 1059
-#define _GUARD_ITER_VIRTUAL_r01 1060
-#define _GUARD_ITER_VIRTUAL_r11 1061
-#define _GUARD_ITER_VIRTUAL_r22 1062
-#define _GUARD_ITER_VIRTUAL_r33 1063
-#define _GUARD_KEYS_VERSION_r01 1064
-#define _GUARD_KEYS_VERSION_r11 1065
-#define _GUARD_KEYS_VERSION_r22 1066
-#define _GUARD_KEYS_VERSION_r33 1067
-#define _GUARD_LOAD_SUPER_ATTR_METHOD_r03 1068
-#define _GUARD_LOAD_SUPER_ATTR_METHOD_r13 1069
-#define _GUARD_LOAD_SUPER_ATTR_METHOD_r23 1070
-#define _GUARD_LOAD_SUPER_ATTR_METHOD_r33 1071
-#define _GUARD_NOS_COMPACT_ASCII_r02 1072
-#define _GUARD_NOS_COMPACT_ASCII_r12 1073
-#define _GUARD_NOS_COMPACT_ASCII_r22 1074
-#define _GUARD_NOS_COMPACT_ASCII_r33 1075
-#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r03 1076
-#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r13 1077
-#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r23 1078
-#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r33 1079
-#define _GUARD_NOS_DICT_SUBSCRIPT_r02 1080
-#define _GUARD_NOS_DICT_SUBSCRIPT_r12 1081
-#define _GUARD_NOS_DICT_SUBSCRIPT_r22 1082
-#define _GUARD_NOS_DICT_SUBSCRIPT_r33 1083
-#define _GUARD_NOS_FLOAT_r02 1084
-#define _GUARD_NOS_FLOAT_r12 1085
-#define _GUARD_NOS_FLOAT_r22 1086
-#define _GUARD_NOS_FLOAT_r33 1087
-#define _GUARD_NOS_INT_r02 1088
-#define _GUARD_NOS_INT_r12 1089
-#define _GUARD_NOS_INT_r22 1090
-#define _GUARD_NOS_INT_r33 1091
-#define _GUARD_NOS_ITER_VIRTUAL_r02 1092
-#define _GUARD_NOS_ITER_VIRTUAL_r12 1093
-#define _GUARD_NOS_ITER_VIRTUAL_r22 1094
-#define _GUARD_NOS_ITER_VIRTUAL_r33 1095
-#define _GUARD_NOS_LIST_r02 1096
-#define _GUARD_NOS_LIST_r12 1097
-#define _GUARD_NOS_LIST_r22 1098
-#define _GUARD_NOS_LIST_r33 1099
-#define _GUARD_NOS_NOT_NULL_r02 1100
-#define _GUARD_NOS_NOT_NULL_r12 1101
-#define _GUARD_NOS_NOT_NULL_r22 1102
-#define _GUARD_NOS_NOT_NULL_r33 1103
-#define _GUARD_NOS_NULL_r02 1104
-#define _GUARD_NOS_NULL_r12 1105
-#define _GUARD_NOS_NULL_r22 1106
-#define _GUARD_NOS_NULL_r33 1107
-#define _GUARD_NOS_OVERFLOWED_r02 1108
-#define _GUARD_NOS_OVERFLOWED_r12 1109
-#define _GUARD_NOS_OVERFLOWED_r22 1110
-#define _GUARD_NOS_OVERFLOWED_r33 1111
-#define _GUARD_NOS_TUPLE_r02 1112
-#define _GUARD_NOS_TUPLE_r12 1113
-#define _GUARD_NOS_TUPLE_r22 1114
-#define _GUARD_NOS_TUPLE_r33 1115
-#define _GUARD_NOS_TYPE_VERSION_r02 1116
-#define _GUARD_NOS_TYPE_VERSION_r12 1117
-#define _GUARD_NOS_TYPE_VERSION_r22 1118
-#define _GUARD_NOS_TYPE_VERSION_r33 1119
-#define _GUARD_NOS_UNICODE_r02 1120
-#define _GUARD_NOS_UNICODE_r12 1121
-#define _GUARD_NOS_UNICODE_r22 1122
-#define _GUARD_NOS_UNICODE_r33 1123
-#define _GUARD_NOT_EXHAUSTED_LIST_r02 1124
-#define _GUARD_NOT_EXHAUSTED_LIST_r12 1125
-#define _GUARD_NOT_EXHAUSTED_LIST_r22 1126
-#define _GUARD_NOT_EXHAUSTED_LIST_r33 1127
-#define _GUARD_NOT_EXHAUSTED_RANGE_r02 1128
-#define _GUARD_NOT_EXHAUSTED_RANGE_r12 1129
-#define _GUARD_NOT_EXHAUSTED_RANGE_r22 1130
-#define _GUARD_NOT_EXHAUSTED_RANGE_r33 1131
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r02 1132
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r12 1133
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r22 1134
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r33 1135
-#define _GUARD_THIRD_NULL_r03 1136
-#define _GUARD_THIRD_NULL_r13 1137
-#define _GUARD_THIRD_NULL_r23 1138
-#define _GUARD_THIRD_NULL_r33 1139
-#define _GUARD_TOS_ANY_DICT_r01 1140
-#define _GUARD_TOS_ANY_DICT_r11 1141
-#define _GUARD_TOS_ANY_DICT_r22 1142
-#define _GUARD_TOS_ANY_DICT_r33 1143
-#define _GUARD_TOS_ANY_SET_r01 1144
-#define _GUARD_TOS_ANY_SET_r11 1145
-#define _GUARD_TOS_ANY_SET_r22 1146
-#define _GUARD_TOS_ANY_SET_r33 1147
-#define _GUARD_TOS_DICT_r01 1148
-#define _GUARD_TOS_DICT_r11 1149
-#define _GUARD_TOS_DICT_r22 1150
-#define _GUARD_TOS_DICT_r33 1151
-#define _GUARD_TOS_FLOAT_r01 1152
-#define _GUARD_TOS_FLOAT_r11 1153
-#define _GUARD_TOS_FLOAT_r22 1154
-#define _GUARD_TOS_FLOAT_r33 1155
-#define _GUARD_TOS_FROZENDICT_r01 1156
-#define _GUARD_TOS_FROZENDICT_r11 1157
-#define _GUARD_TOS_FROZENDICT_r22 1158
-#define _GUARD_TOS_FROZENDICT_r33 1159
-#define _GUARD_TOS_FROZENSET_r01 1160
-#define _GUARD_TOS_FROZENSET_r11 1161
-#define _GUARD_TOS_FROZENSET_r22 1162
-#define _GUARD_TOS_FROZENSET_r33 1163
-#define _GUARD_TOS_INT_r01 1164
-#define _GUARD_TOS_INT_r11 1165
-#define _GUARD_TOS_INT_r22 1166
-#define _GUARD_TOS_INT_r33 1167
-#define _GUARD_TOS_IS_NONE_r01 1168
-#define _GUARD_TOS_IS_NONE_r11 1169
-#define _GUARD_TOS_IS_NONE_r22 1170
-#define _GUARD_TOS_IS_NONE_r33 1171
-#define _GUARD_TOS_LIST_r01 1172
-#define _GUARD_TOS_LIST_r11 1173
-#define _GUARD_TOS_LIST_r22 1174
-#define _GUARD_TOS_LIST_r33 1175
-#define _GUARD_TOS_NOT_NULL_r01 1176
-#define _GUARD_TOS_NOT_NULL_r11 1177
-#define _GUARD_TOS_NOT_NULL_r22 1178
-#define _GUARD_TOS_NOT_NULL_r33 1179
-#define _GUARD_TOS_OVERFLOWED_r01 1180
-#define _GUARD_TOS_OVERFLOWED_r11 1181
-#define _GUARD_TOS_OVERFLOWED_r22 1182
-#define _GUARD_TOS_OVERFLOWED_r33 1183
-#define _GUARD_TOS_SET_r01 1184
-#define _GUARD_TOS_SET_r11 1185
-#define _GUARD_TOS_SET_r22 1186
-#define _GUARD_TOS_SET_r33 1187
-#define _GUARD_TOS_SLICE_r01 1188
-#define _GUARD_TOS_SLICE_r11 1189
-#define _GUARD_TOS_SLICE_r22 1190
-#define _GUARD_TOS_SLICE_r33 1191
-#define _GUARD_TOS_TUPLE_r01 1192
-#define _GUARD_TOS_TUPLE_r11 1193
-#define _GUARD_TOS_TUPLE_r22 1194
-#define _GUARD_TOS_TUPLE_r33 1195
-#define _GUARD_TOS_UNICODE_r01 1196
-#define _GUARD_TOS_UNICODE_r11 1197
-#define _GUARD_TOS_UNICODE_r22 1198
-#define _GUARD_TOS_UNICODE_r33 1199
-#define _GUARD_TYPE_r01 1200
-#define _GUARD_TYPE_r11 1201
-#define _GUARD_TYPE_r22 1202
-#define _GUARD_TYPE_r33 1203
-#define _GUARD_TYPE_ITER_r02 1204
-#define _GUARD_TYPE_ITER_r12 1205
-#define _GUARD_TYPE_ITER_r22 1206
-#define _GUARD_TYPE_ITER_r33 1207
-#define _GUARD_TYPE_VERSION_r01 1208
-#define _GUARD_TYPE_VERSION_r11 1209
-#define _GUARD_TYPE_VERSION_r22 1210
-#define _GUARD_TYPE_VERSION_r33 1211
-#define _GUARD_TYPE_VERSION_LOCKED_r01 1212
-#define _GUARD_TYPE_VERSION_LOCKED_r11 1213
-#define _GUARD_TYPE_VERSION_LOCKED_r22 1214
-#define _GUARD_TYPE_VERSION_LOCKED_r33 1215
-#define _HANDLE_PENDING_AND_DEOPT_r00 1216
-#define _HANDLE_PENDING_AND_DEOPT_r10 1217
-#define _HANDLE_PENDING_AND_DEOPT_r20 1218
-#define _HANDLE_PENDING_AND_DEOPT_r30 1219
-#define _IMPORT_FROM_r12 1220
-#define _IMPORT_NAME_r21 1221
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS_r00 1222
-#define _INIT_CALL_PY_EXACT_ARGS_r01 1223
-#define _INIT_CALL_PY_EXACT_ARGS_0_r01 1224
-#define _INIT_CALL_PY_EXACT_ARGS_1_r01 1225
-#define _INIT_CALL_PY_EXACT_ARGS_2_r01 1226
-#define _INIT_CALL_PY_EXACT_ARGS_3_r01 1227
-#define _INIT_CALL_PY_EXACT_ARGS_4_r01 1228
-#define _INSERT_NULL_r10 1229
-#define _INSTRUMENTED_FOR_ITER_r23 1230
-#define _INSTRUMENTED_INSTRUCTION_r00 1231
-#define _INSTRUMENTED_JUMP_FORWARD_r00 1232
-#define _INSTRUMENTED_JUMP_FORWARD_r11 1233
-#define _INSTRUMENTED_JUMP_FORWARD_r22 1234
-#define _INSTRUMENTED_JUMP_FORWARD_r33 1235
-#define _INSTRUMENTED_LINE_r00 1236
-#define _INSTRUMENTED_NOT_TAKEN_r00 1237
-#define _INSTRUMENTED_NOT_TAKEN_r11 1238
-#define _INSTRUMENTED_NOT_TAKEN_r22 1239
-#define _INSTRUMENTED_NOT_TAKEN_r33 1240
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r00 1241
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r10 1242
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r21 1243
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r32 1244
-#define _INSTRUMENTED_POP_JUMP_IF_NONE_r10 1245
-#define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE_r10 1246
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r00 1247
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r10 1248
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r21 1249
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r32 1250
-#define _IS_NONE_r11 1251
-#define _IS_OP_r03 1252
-#define _IS_OP_r13 1253
-#define _IS_OP_r23 1254
-#define _ITER_CHECK_LIST_r02 1255
-#define _ITER_CHECK_LIST_r12 1256
-#define _ITER_CHECK_LIST_r22 1257
-#define _ITER_CHECK_LIST_r33 1258
-#define _ITER_CHECK_RANGE_r02 1259
-#define _ITER_CHECK_RANGE_r12 1260
-#define _ITER_CHECK_RANGE_r22 1261
-#define _ITER_CHECK_RANGE_r33 1262
-#define _ITER_CHECK_TUPLE_r02 1263
-#define _ITER_CHECK_TUPLE_r12 1264
-#define _ITER_CHECK_TUPLE_r22 1265
-#define _ITER_CHECK_TUPLE_r33 1266
-#define _ITER_JUMP_LIST_r02 1267
-#define _ITER_JUMP_LIST_r12 1268
-#define _ITER_JUMP_LIST_r22 1269
-#define _ITER_JUMP_LIST_r33 1270
-#define _ITER_JUMP_RANGE_r02 1271
-#define _ITER_JUMP_RANGE_r12 1272
-#define _ITER_JUMP_RANGE_r22 1273
-#define _ITER_JUMP_RANGE_r33 1274
-#define _ITER_JUMP_TUPLE_r02 1275
-#define _ITER_JUMP_TUPLE_r12 1276
-#define _ITER_JUMP_TUPLE_r22 1277
-#define _ITER_JUMP_TUPLE_r33 1278
-#define _ITER_NEXT_INLINE_r23 1279
-#define _ITER_NEXT_LIST_r23 1280
-#define _ITER_NEXT_LIST_TIER_TWO_r23 1281
-#define _ITER_NEXT_RANGE_r03 1282
-#define _ITER_NEXT_RANGE_r13 1283
-#define _ITER_NEXT_RANGE_r23 1284
-#define _ITER_NEXT_TUPLE_r03 1285
-#define _ITER_NEXT_TUPLE_r13 1286
-#define _ITER_NEXT_TUPLE_r23 1287
-#define _JUMP_BACKWARD_NO_INTERRUPT_r00 1288
-#define _JUMP_BACKWARD_NO_INTERRUPT_r11 1289
-#define _JUMP_BACKWARD_NO_INTERRUPT_r22 1290
-#define _JUMP_BACKWARD_NO_INTERRUPT_r33 1291
-#define _JUMP_TO_TOP_r00 1292
-#define _LIST_APPEND_r10 1293
-#define _LIST_EXTEND_r11 1294
-#define _LOAD_ATTR_r10 1295
-#define _LOAD_ATTR_CLASS_r11 1296
-#define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN_FRAME_r11 1297
-#define _LOAD_ATTR_INSTANCE_VALUE_r02 1298
-#define _LOAD_ATTR_INSTANCE_VALUE_r12 1299
-#define _LOAD_ATTR_INSTANCE_VALUE_r23 1300
-#define _LOAD_ATTR_METHOD_LAZY_DICT_r02 1301
-#define _LOAD_ATTR_METHOD_LAZY_DICT_r12 1302
-#define _LOAD_ATTR_METHOD_LAZY_DICT_r23 1303
-#define _LOAD_ATTR_METHOD_NO_DICT_r02 1304
-#define _LOAD_ATTR_METHOD_NO_DICT_r12 1305
-#define _LOAD_ATTR_METHOD_NO_DICT_r23 1306
-#define _LOAD_ATTR_METHOD_WITH_VALUES_r02 1307
-#define _LOAD_ATTR_METHOD_WITH_VALUES_r12 1308
-#define _LOAD_ATTR_METHOD_WITH_VALUES_r23 1309
-#define _LOAD_ATTR_MODULE_r12 1310
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11 1311
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11 1312
-#define _LOAD_ATTR_PROPERTY_FRAME_r01 1313
-#define _LOAD_ATTR_PROPERTY_FRAME_r11 1314
-#define _LOAD_ATTR_PROPERTY_FRAME_r22 1315
-#define _LOAD_ATTR_PROPERTY_FRAME_r33 1316
-#define _LOAD_ATTR_SLOT_r02 1317
-#define _LOAD_ATTR_SLOT_r12 1318
-#define _LOAD_ATTR_SLOT_r23 1319
-#define _LOAD_ATTR_WITH_HINT_r12 1320
-#define _LOAD_BUILD_CLASS_r01 1321
-#define _LOAD_BYTECODE_r00 1322
-#define _LOAD_COMMON_CONSTANT_r01 1323
-#define _LOAD_COMMON_CONSTANT_r12 1324
-#define _LOAD_COMMON_CONSTANT_r23 1325
-#define _LOAD_CONST_r01 1326
-#define _LOAD_CONST_r12 1327
-#define _LOAD_CONST_r23 1328
-#define _LOAD_CONST_INLINE_r01 1329
-#define _LOAD_CONST_INLINE_r12 1330
-#define _LOAD_CONST_INLINE_r23 1331
-#define _LOAD_CONST_INLINE_BORROW_r01 1332
-#define _LOAD_CONST_INLINE_BORROW_r12 1333
-#define _LOAD_CONST_INLINE_BORROW_r23 1334
-#define _LOAD_DEREF_r01 1335
-#define _LOAD_FAST_r01 1336
-#define _LOAD_FAST_r12 1337
-#define _LOAD_FAST_r23 1338
-#define _LOAD_FAST_0_r01 1339
-#define _LOAD_FAST_0_r12 1340
-#define _LOAD_FAST_0_r23 1341
-#define _LOAD_FAST_1_r01 1342
-#define _LOAD_FAST_1_r12 1343
-#define _LOAD_FAST_1_r23 1344
-#define _LOAD_FAST_2_r01 1345
-#define _LOAD_FAST_2_r12 1346
-#define _LOAD_FAST_2_r23 1347
-#define _LOAD_FAST_3_r01 1348
-#define _LOAD_FAST_3_r12 1349
-#define _LOAD_FAST_3_r23 1350
-#define _LOAD_FAST_4_r01 1351
-#define _LOAD_FAST_4_r12 1352
-#define _LOAD_FAST_4_r23 1353
-#define _LOAD_FAST_5_r01 1354
-#define _LOAD_FAST_5_r12 1355
-#define _LOAD_FAST_5_r23 1356
-#define _LOAD_FAST_6_r01 1357
-#define _LOAD_FAST_6_r12 1358
-#define _LOAD_FAST_6_r23 1359
-#define _LOAD_FAST_7_r01 1360
-#define _LOAD_FAST_7_r12 1361
-#define _LOAD_FAST_7_r23 1362
-#define _LOAD_FAST_AND_CLEAR_r01 1363
-#define _LOAD_FAST_AND_CLEAR_r12 1364
-#define _LOAD_FAST_AND_CLEAR_r23 1365
-#define _LOAD_FAST_BORROW_r01 1366
-#define _LOAD_FAST_BORROW_r12 1367
-#define _LOAD_FAST_BORROW_r23 1368
-#define _LOAD_FAST_BORROW_0_r01 1369
-#define _LOAD_FAST_BORROW_0_r12 1370
-#define _LOAD_FAST_BORROW_0_r23 1371
-#define _LOAD_FAST_BORROW_1_r01 1372
-#define _LOAD_FAST_BORROW_1_r12 1373
-#define _LOAD_FAST_BORROW_1_r23 1374
-#define _LOAD_FAST_BORROW_2_r01 1375
-#define _LOAD_FAST_BORROW_2_r12 1376
-#define _LOAD_FAST_BORROW_2_r23 1377
-#define _LOAD_FAST_BORROW_3_r01 1378
-#define _LOAD_FAST_BORROW_3_r12 1379
-#define _LOAD_FAST_BORROW_3_r23 1380
-#define _LOAD_FAST_BORROW_4_r01 1381
-#define _LOAD_FAST_BORROW_4_r12 1382
-#define _LOAD_FAST_BORROW_4_r23 1383
-#define _LOAD_FAST_BORROW_5_r01 1384
-#define _LOAD_FAST_BORROW_5_r12 1385
-#define _LOAD_FAST_BORROW_5_r23 1386
-#define _LOAD_FAST_BORROW_6_r01 1387
-#define _LOAD_FAST_BORROW_6_r12 1388
-#define _LOAD_FAST_BORROW_6_r23 1389
-#define _LOAD_FAST_BORROW_7_r01 1390
-#define _LOAD_FAST_BORROW_7_r12 1391
-#define _LOAD_FAST_BORROW_7_r23 1392
-#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r02 1393
-#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r13 1394
-#define _LOAD_FAST_CHECK_r01 1395
-#define _LOAD_FAST_CHECK_r12 1396
-#define _LOAD_FAST_CHECK_r23 1397
-#define _LOAD_FAST_LOAD_FAST_r02 1398
-#define _LOAD_FAST_LOAD_FAST_r13 1399
-#define _LOAD_FROM_DICT_OR_DEREF_r11 1400
-#define _LOAD_FROM_DICT_OR_GLOBALS_r11 1401
-#define _LOAD_GLOBAL_r00 1402
-#define _LOAD_GLOBAL_BUILTINS_r01 1403
-#define _LOAD_GLOBAL_MODULE_r01 1404
-#define _LOAD_LOCALS_r01 1405
-#define _LOAD_LOCALS_r12 1406
-#define _LOAD_LOCALS_r23 1407
-#define _LOAD_NAME_r01 1408
-#define _LOAD_SMALL_INT_r01 1409
-#define _LOAD_SMALL_INT_r12 1410
-#define _LOAD_SMALL_INT_r23 1411
-#define _LOAD_SMALL_INT_0_r01 1412
-#define _LOAD_SMALL_INT_0_r12 1413
-#define _LOAD_SMALL_INT_0_r23 1414
-#define _LOAD_SMALL_INT_1_r01 1415
-#define _LOAD_SMALL_INT_1_r12 1416
-#define _LOAD_SMALL_INT_1_r23 1417
-#define _LOAD_SMALL_INT_2_r01 1418
-#define _LOAD_SMALL_INT_2_r12 1419
-#define _LOAD_SMALL_INT_2_r23 1420
-#define _LOAD_SMALL_INT_3_r01 1421
-#define _LOAD_SMALL_INT_3_r12 1422
-#define _LOAD_SMALL_INT_3_r23 1423
-#define _LOAD_SPECIAL_r00 1424
-#define _LOAD_SUPER_ATTR_ATTR_r31 1425
-#define _LOAD_SUPER_ATTR_METHOD_r32 1426
-#define _LOCK_OBJECT_r01 1427
-#define _LOCK_OBJECT_r11 1428
-#define _LOCK_OBJECT_r22 1429
-#define _LOCK_OBJECT_r33 1430
-#define _MAKE_CALLARGS_A_TUPLE_r33 1431
-#define _MAKE_CELL_r00 1432
-#define _MAKE_FUNCTION_r12 1433
-#define _MAKE_HEAP_SAFE_r01 1434
-#define _MAKE_HEAP_SAFE_r11 1435
-#define _MAKE_HEAP_SAFE_r22 1436
-#define _MAKE_HEAP_SAFE_r33 1437
-#define _MAKE_WARM_r00 1438
-#define _MAKE_WARM_r11 1439
-#define _MAKE_WARM_r22 1440
-#define _MAKE_WARM_r33 1441
-#define _MAP_ADD_r20 1442
-#define _MATCH_CLASS_r33 1443
-#define _MATCH_KEYS_r23 1444
-#define _MATCH_MAPPING_r02 1445
-#define _MATCH_MAPPING_r12 1446
-#define _MATCH_MAPPING_r23 1447
-#define _MATCH_SEQUENCE_r02 1448
-#define _MATCH_SEQUENCE_r12 1449
-#define _MATCH_SEQUENCE_r23 1450
-#define _MAYBE_EXPAND_METHOD_r00 1451
-#define _MAYBE_EXPAND_METHOD_KW_r11 1452
-#define _MONITOR_CALL_r00 1453
-#define _MONITOR_CALL_KW_r11 1454
-#define _MONITOR_JUMP_BACKWARD_r00 1455
-#define _MONITOR_JUMP_BACKWARD_r11 1456
-#define _MONITOR_JUMP_BACKWARD_r22 1457
-#define _MONITOR_JUMP_BACKWARD_r33 1458
-#define _MONITOR_RESUME_r00 1459
-#define _NOP_r00 1460
-#define _NOP_r11 1461
-#define _NOP_r22 1462
-#define _NOP_r33 1463
-#define _POP_EXCEPT_r10 1464
-#define _POP_ITER_r20 1465
-#define _POP_JUMP_IF_FALSE_r00 1466
-#define _POP_JUMP_IF_FALSE_r10 1467
-#define _POP_JUMP_IF_FALSE_r21 1468
-#define _POP_JUMP_IF_FALSE_r32 1469
-#define _POP_JUMP_IF_TRUE_r00 1470
-#define _POP_JUMP_IF_TRUE_r10 1471
-#define _POP_JUMP_IF_TRUE_r21 1472
-#define _POP_JUMP_IF_TRUE_r32 1473
-#define _POP_TOP_r10 1474
-#define _POP_TOP_FLOAT_r00 1475
-#define _POP_TOP_FLOAT_r10 1476
-#define _POP_TOP_FLOAT_r21 1477
-#define _POP_TOP_FLOAT_r32 1478
-#define _POP_TOP_INT_r00 1479
-#define _POP_TOP_INT_r10 1480
-#define _POP_TOP_INT_r21 1481
-#define _POP_TOP_INT_r32 1482
-#define _POP_TOP_NOP_r00 1483
-#define _POP_TOP_NOP_r10 1484
-#define _POP_TOP_NOP_r21 1485
-#define _POP_TOP_NOP_r32 1486
-#define _POP_TOP_OPARG_r00 1487
-#define _POP_TOP_UNICODE_r00 1488
-#define _POP_TOP_UNICODE_r10 1489
-#define _POP_TOP_UNICODE_r21 1490
-#define _POP_TOP_UNICODE_r32 1491
-#define _PUSH_EXC_INFO_r02 1492
-#define _PUSH_EXC_INFO_r12 1493
-#define _PUSH_EXC_INFO_r23 1494
-#define _PUSH_FRAME_r10 1495
-#define _PUSH_NULL_r01 1496
-#define _PUSH_NULL_r12 1497
-#define _PUSH_NULL_r23 1498
-#define _PUSH_NULL_CONDITIONAL_r00 1499
-#define _PUSH_TAGGED_ZERO_r01 1500
-#define _PUSH_TAGGED_ZERO_r12 1501
-#define _PUSH_TAGGED_ZERO_r23 1502
-#define _PY_FRAME_EX_r31 1503
-#define _PY_FRAME_GENERAL_r01 1504
-#define _PY_FRAME_KW_r11 1505
-#define _REPLACE_WITH_TRUE_r02 1506
-#define _REPLACE_WITH_TRUE_r12 1507
-#define _REPLACE_WITH_TRUE_r23 1508
-#define _RESUME_CHECK_r00 1509
-#define _RESUME_CHECK_r11 1510
-#define _RESUME_CHECK_r22 1511
-#define _RESUME_CHECK_r33 1512
-#define _RETURN_GENERATOR_r01 1513
-#define _RETURN_VALUE_r11 1514
-#define _RROT_3_r03 1515
-#define _RROT_3_r13 1516
-#define _RROT_3_r23 1517
-#define _RROT_3_r33 1518
-#define _SAVE_RETURN_OFFSET_r00 1519
-#define _SAVE_RETURN_OFFSET_r11 1520
-#define _SAVE_RETURN_OFFSET_r22 1521
-#define _SAVE_RETURN_OFFSET_r33 1522
-#define _SEND_ASYNC_GEN_r33 1523
-#define _SEND_ASYNC_GEN_TIER_TWO_r33 1524
-#define _SEND_GEN_FRAME_r33 1525
-#define _SEND_VIRTUAL_r33 1526
-#define _SEND_VIRTUAL_TIER_TWO_r03 1527
-#define _SEND_VIRTUAL_TIER_TWO_r13 1528
-#define _SEND_VIRTUAL_TIER_TWO_r23 1529
-#define _SEND_VIRTUAL_TIER_TWO_r33 1530
-#define _SETUP_ANNOTATIONS_r00 1531
-#define _SET_ADD_r10 1532
-#define _SET_FUNCTION_ATTRIBUTE_r01 1533
-#define _SET_FUNCTION_ATTRIBUTE_r11 1534
-#define _SET_FUNCTION_ATTRIBUTE_r21 1535
-#define _SET_FUNCTION_ATTRIBUTE_r32 1536
-#define _SET_IP_r00 1537
-#define _SET_IP_r11 1538
-#define _SET_IP_r22 1539
-#define _SET_IP_r33 1540
-#define _SET_UPDATE_r11 1541
-#define _SPILL_OR_RELOAD_r01 1542
-#define _SPILL_OR_RELOAD_r02 1543
-#define _SPILL_OR_RELOAD_r03 1544
-#define _SPILL_OR_RELOAD_r10 1545
-#define _SPILL_OR_RELOAD_r12 1546
-#define _SPILL_OR_RELOAD_r13 1547
-#define _SPILL_OR_RELOAD_r20 1548
-#define _SPILL_OR_RELOAD_r21 1549
-#define _SPILL_OR_RELOAD_r23 1550
-#define _SPILL_OR_RELOAD_r30 1551
-#define _SPILL_OR_RELOAD_r31 1552
-#define _SPILL_OR_RELOAD_r32 1553
-#define _START_EXECUTOR_r00 1554
-#define _STORE_ATTR_r20 1555
-#define _STORE_ATTR_INSTANCE_VALUE_r21 1556
-#define _STORE_ATTR_SLOT_r21 1557
-#define _STORE_ATTR_WITH_HINT_r21 1558
-#define _STORE_DEREF_r10 1559
-#define _STORE_FAST_LOAD_FAST_r11 1560
-#define _STORE_FAST_STORE_FAST_r20 1561
-#define _STORE_GLOBAL_r10 1562
-#define _STORE_NAME_r10 1563
-#define _STORE_SLICE_r30 1564
-#define _STORE_SUBSCR_r30 1565
-#define _STORE_SUBSCR_DICT_r31 1566
-#define _STORE_SUBSCR_DICT_KNOWN_HASH_r31 1567
-#define _STORE_SUBSCR_LIST_INT_r32 1568
-#define _SWAP_r11 1569
-#define _SWAP_2_r02 1570
-#define _SWAP_2_r12 1571
-#define _SWAP_2_r22 1572
-#define _SWAP_2_r33 1573
-#define _SWAP_3_r03 1574
-#define _SWAP_3_r13 1575
-#define _SWAP_3_r23 1576
-#define _SWAP_3_r33 1577
-#define _SWAP_FAST_r01 1578
-#define _SWAP_FAST_r11 1579
-#define _SWAP_FAST_r22 1580
-#define _SWAP_FAST_r33 1581
-#define _SWAP_FAST_0_r01 1582
-#define _SWAP_FAST_0_r11 1583
-#define _SWAP_FAST_0_r22 1584
-#define _SWAP_FAST_0_r33 1585
-#define _SWAP_FAST_1_r01 1586
-#define _SWAP_FAST_1_r11 1587
-#define _SWAP_FAST_1_r22 1588
-#define _SWAP_FAST_1_r33 1589
-#define _SWAP_FAST_2_r01 1590
-#define _SWAP_FAST_2_r11 1591
-#define _SWAP_FAST_2_r22 1592
-#define _SWAP_FAST_2_r33 1593
-#define _SWAP_FAST_3_r01 1594
-#define _SWAP_FAST_3_r11 1595
-#define _SWAP_FAST_3_r22 1596
-#define _SWAP_FAST_3_r33 1597
-#define _SWAP_FAST_4_r01 1598
-#define _SWAP_FAST_4_r11 1599
-#define _SWAP_FAST_4_r22 1600
-#define _SWAP_FAST_4_r33 1601
-#define _SWAP_FAST_5_r01 1602
-#define _SWAP_FAST_5_r11 1603
-#define _SWAP_FAST_5_r22 1604
-#define _SWAP_FAST_5_r33 1605
-#define _SWAP_FAST_6_r01 1606
-#define _SWAP_FAST_6_r11 1607
-#define _SWAP_FAST_6_r22 1608
-#define _SWAP_FAST_6_r33 1609
-#define _SWAP_FAST_7_r01 1610
-#define _SWAP_FAST_7_r11 1611
-#define _SWAP_FAST_7_r22 1612
-#define _SWAP_FAST_7_r33 1613
-#define _TIER2_RESUME_CHECK_r00 1614
-#define _TIER2_RESUME_CHECK_r11 1615
-#define _TIER2_RESUME_CHECK_r22 1616
-#define _TIER2_RESUME_CHECK_r33 1617
-#define _TO_BOOL_r11 1618
-#define _TO_BOOL_BOOL_r01 1619
-#define _TO_BOOL_BOOL_r11 1620
-#define _TO_BOOL_BOOL_r22 1621
-#define _TO_BOOL_BOOL_r33 1622
-#define _TO_BOOL_INT_r02 1623
-#define _TO_BOOL_INT_r12 1624
-#define _TO_BOOL_INT_r23 1625
-#define _TO_BOOL_LIST_r02 1626
-#define _TO_BOOL_LIST_r12 1627
-#define _TO_BOOL_LIST_r23 1628
-#define _TO_BOOL_NONE_r01 1629
-#define _TO_BOOL_NONE_r11 1630
-#define _TO_BOOL_NONE_r22 1631
-#define _TO_BOOL_NONE_r33 1632
-#define _TO_BOOL_STR_r02 1633
-#define _TO_BOOL_STR_r12 1634
-#define _TO_BOOL_STR_r23 1635
-#define _TRACE_RECORD_r00 1636
-#define _UNARY_INVERT_r12 1637
-#define _UNARY_NEGATIVE_r12 1638
-#define _UNARY_NEGATIVE_FLOAT_INPLACE_r02 1639
-#define _UNARY_NEGATIVE_FLOAT_INPLACE_r12 1640
-#define _UNARY_NEGATIVE_FLOAT_INPLACE_r23 1641
-#define _UNARY_NOT_r01 1642
-#define _UNARY_NOT_r11 1643
-#define _UNARY_NOT_r22 1644
-#define _UNARY_NOT_r33 1645
-#define _UNPACK_EX_r10 1646
-#define _UNPACK_SEQUENCE_r10 1647
-#define _UNPACK_SEQUENCE_LIST_r10 1648
-#define _UNPACK_SEQUENCE_TUPLE_r10 1649
-#define _UNPACK_SEQUENCE_TWO_TUPLE_r12 1650
-#define _UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE_r03 1651
-#define _UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE_r13 1652
-#define _UNPACK_SEQUENCE_UNIQUE_TUPLE_r10 1653
-#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE_r02 1654
-#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE_r12 1655
-#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE_r23 1656
-#define _WITH_EXCEPT_START_r33 1657
-#define _YIELD_VALUE_r11 1658
-#define MAX_UOP_REGS_ID 1658
+#define _YIELD_VALUE 668
+#define MAX_UOP_ID 668
+#define _ALLOCATE_OBJECT_r00 669
+#define _BINARY_OP_r23 670
+#define _BINARY_OP_ADD_FLOAT_r03 671
+#define _BINARY_OP_ADD_FLOAT_r13 672
+#define _BINARY_OP_ADD_FLOAT_r23 673
+#define _BINARY_OP_ADD_FLOAT_INPLACE_r03 674
+#define _BINARY_OP_ADD_FLOAT_INPLACE_r13 675
+#define _BINARY_OP_ADD_FLOAT_INPLACE_r23 676
+#define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r03 677
+#define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r13 678
+#define _BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r23 679
+#define _BINARY_OP_ADD_FLOAT_INT_INPLACE_r03 680
+#define _BINARY_OP_ADD_FLOAT_INT_INPLACE_r13 681
+#define _BINARY_OP_ADD_FLOAT_INT_INPLACE_r23 682
+#define _BINARY_OP_ADD_INT_r03 683
+#define _BINARY_OP_ADD_INT_r13 684
+#define _BINARY_OP_ADD_INT_r23 685
+#define _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r03 686
+#define _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r13 687
+#define _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r23 688
+#define _BINARY_OP_ADD_INT_INPLACE_r03 689
+#define _BINARY_OP_ADD_INT_INPLACE_r13 690
+#define _BINARY_OP_ADD_INT_INPLACE_r23 691
+#define _BINARY_OP_ADD_INT_INPLACE_RIGHT_r03 692
+#define _BINARY_OP_ADD_INT_INPLACE_RIGHT_r13 693
+#define _BINARY_OP_ADD_INT_INPLACE_RIGHT_r23 694
+#define _BINARY_OP_ADD_UNICODE_r03 695
+#define _BINARY_OP_ADD_UNICODE_r13 696
+#define _BINARY_OP_ADD_UNICODE_r23 697
+#define _BINARY_OP_ADD_UNICODE_INPLACE_r23 698
+#define _BINARY_OP_EXTEND_r23 699
+#define _BINARY_OP_INPLACE_ADD_UNICODE_r21 700
+#define _BINARY_OP_MULTIPLY_FLOAT_r03 701
+#define _BINARY_OP_MULTIPLY_FLOAT_r13 702
+#define _BINARY_OP_MULTIPLY_FLOAT_r23 703
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r03 704
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r13 705
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23 706
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r03 707
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r13 708
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r23 709
+#define _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r03 710
+#define _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r13 711
+#define _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r23 712
+#define _BINARY_OP_MULTIPLY_INT_r03 713
+#define _BINARY_OP_MULTIPLY_INT_r13 714
+#define _BINARY_OP_MULTIPLY_INT_r23 715
+#define _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r03 716
+#define _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r13 717
+#define _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r23 718
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_r03 719
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_r13 720
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_r23 721
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT_r03 722
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT_r13 723
+#define _BINARY_OP_MULTIPLY_INT_INPLACE_RIGHT_r23 724
+#define _BINARY_OP_SUBSCR_CHECK_FUNC_r23 725
+#define _BINARY_OP_SUBSCR_DICT_r23 726
+#define _BINARY_OP_SUBSCR_DICT_KNOWN_HASH_r23 727
+#define _BINARY_OP_SUBSCR_INIT_CALL_r01 728
+#define _BINARY_OP_SUBSCR_INIT_CALL_r11 729
+#define _BINARY_OP_SUBSCR_INIT_CALL_r21 730
+#define _BINARY_OP_SUBSCR_INIT_CALL_r31 731
+#define _BINARY_OP_SUBSCR_LIST_INT_r23 732
+#define _BINARY_OP_SUBSCR_LIST_SLICE_r23 733
+#define _BINARY_OP_SUBSCR_STR_INT_r23 734
+#define _BINARY_OP_SUBSCR_TUPLE_INT_r03 735
+#define _BINARY_OP_SUBSCR_TUPLE_INT_r13 736
+#define _BINARY_OP_SUBSCR_TUPLE_INT_r23 737
+#define _BINARY_OP_SUBSCR_USTR_INT_r23 738
+#define _BINARY_OP_SUBTRACT_FLOAT_r03 739
+#define _BINARY_OP_SUBTRACT_FLOAT_r13 740
+#define _BINARY_OP_SUBTRACT_FLOAT_r23 741
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r03 742
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r13 743
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23 744
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r03 745
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r13 746
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r23 747
+#define _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r03 748
+#define _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r13 749
+#define _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r23 750
+#define _BINARY_OP_SUBTRACT_INT_r03 751
+#define _BINARY_OP_SUBTRACT_INT_r13 752
+#define _BINARY_OP_SUBTRACT_INT_r23 753
+#define _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r03 754
+#define _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r13 755
+#define _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r23 756
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_r03 757
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_r13 758
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_r23 759
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT_r03 760
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT_r13 761
+#define _BINARY_OP_SUBTRACT_INT_INPLACE_RIGHT_r23 762
+#define _BINARY_OP_TRUEDIV_FLOAT_r23 763
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_r03 764
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_r13 765
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_r23 766
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r03 767
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r13 768
+#define _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r23 769
+#define _BINARY_SLICE_r31 770
+#define _BUILD_INTERPOLATION_r01 771
+#define _BUILD_LIST_r01 772
+#define _BUILD_MAP_r01 773
+#define _BUILD_SET_r01 774
+#define _BUILD_SLICE_r01 775
+#define _BUILD_STRING_r01 776
+#define _BUILD_TEMPLATE_r21 777
+#define _BUILD_TUPLE_r01 778
+#define _CALL_BUILTIN_CLASS_r00 779
+#define _CALL_BUILTIN_FAST_r00 780
+#define _CALL_BUILTIN_FAST_WITH_KEYWORDS_r00 781
+#define _CALL_BUILTIN_O_r03 782
+#define _CALL_FUNCTION_EX_NON_PY_GENERAL_r31 783
+#define _CALL_INTRINSIC_1_r12 784
+#define _CALL_INTRINSIC_2_r23 785
+#define _CALL_ISINSTANCE_r31 786
+#define _CALL_KW_BUILTIN_CLASS_r11 787
+#define _CALL_KW_BUILTIN_FAST_r11 788
+#define _CALL_KW_METHOD_DESCRIPTOR_FAST_r11 789
+#define _CALL_KW_NON_PY_r11 790
+#define _CALL_LEN_r33 791
+#define _CALL_LIST_APPEND_r03 792
+#define _CALL_LIST_APPEND_r13 793
+#define _CALL_LIST_APPEND_r23 794
+#define _CALL_LIST_APPEND_r33 795
+#define _CALL_METHOD_DESCRIPTOR_FAST_r00 796
+#define _CALL_METHOD_DESCRIPTOR_FAST_INLINE_r00 797
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r00 798
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_INLINE_r00 799
+#define _CALL_METHOD_DESCRIPTOR_NOARGS_r03 800
+#define _CALL_METHOD_DESCRIPTOR_NOARGS_INLINE_r03 801
+#define _CALL_METHOD_DESCRIPTOR_O_r03 802
+#define _CALL_METHOD_DESCRIPTOR_O_INLINE_r03 803
+#define _CALL_NON_PY_GENERAL_r01 804
+#define _CALL_STR_1_r32 805
+#define _CALL_TUPLE_1_r32 806
+#define _CALL_TYPE_1_r02 807
+#define _CALL_TYPE_1_r12 808
+#define _CALL_TYPE_1_r22 809
+#define _CALL_TYPE_1_r32 810
+#define _CHECK_ATTR_CLASS_r01 811
+#define _CHECK_ATTR_CLASS_r11 812
+#define _CHECK_ATTR_CLASS_r22 813
+#define _CHECK_ATTR_CLASS_r33 814
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r01 815
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r11 816
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r22 817
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r33 818
+#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS_r00 819
+#define _CHECK_EG_MATCH_r22 820
+#define _CHECK_EXC_MATCH_r22 821
+#define _CHECK_FUNCTION_EXACT_ARGS_r00 822
+#define _CHECK_FUNCTION_VERSION_r00 823
+#define _CHECK_FUNCTION_VERSION_INLINE_r00 824
+#define _CHECK_FUNCTION_VERSION_INLINE_r11 825
+#define _CHECK_FUNCTION_VERSION_INLINE_r22 826
+#define _CHECK_FUNCTION_VERSION_INLINE_r33 827
+#define _CHECK_FUNCTION_VERSION_KW_r11 828
+#define _CHECK_IS_NOT_PY_CALLABLE_r00 829
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r03 830
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r13 831
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r23 832
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r33 833
+#define _CHECK_IS_NOT_PY_CALLABLE_KW_r11 834
+#define _CHECK_IS_PY_CALLABLE_EX_r03 835
+#define _CHECK_IS_PY_CALLABLE_EX_r13 836
+#define _CHECK_IS_PY_CALLABLE_EX_r23 837
+#define _CHECK_IS_PY_CALLABLE_EX_r33 838
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r01 839
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r11 840
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r22 841
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r33 842
+#define _CHECK_METHOD_VERSION_r00 843
+#define _CHECK_METHOD_VERSION_KW_r11 844
+#define _CHECK_OBJECT_r00 845
+#define _CHECK_PEP_523_r00 846
+#define _CHECK_PEP_523_r11 847
+#define _CHECK_PEP_523_r22 848
+#define _CHECK_PEP_523_r33 849
+#define _CHECK_PERIODIC_r00 850
+#define _CHECK_PERIODIC_AT_END_r00 851
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00 852
+#define _CHECK_RECURSION_LIMIT_r00 853
+#define _CHECK_RECURSION_LIMIT_r11 854
+#define _CHECK_RECURSION_LIMIT_r22 855
+#define _CHECK_RECURSION_LIMIT_r33 856
+#define _CHECK_RECURSION_REMAINING_r00 857
+#define _CHECK_RECURSION_REMAINING_r11 858
+#define _CHECK_RECURSION_REMAINING_r22 859
+#define _CHECK_RECURSION_REMAINING_r33 860
+#define _CHECK_STACK_SPACE_r00 861
+#define _CHECK_STACK_SPACE_OPERAND_r00 862
+#define _CHECK_STACK_SPACE_OPERAND_r11 863
+#define _CHECK_STACK_SPACE_OPERAND_r22 864
+#define _CHECK_STACK_SPACE_OPERAND_r33 865
+#define _CHECK_VALIDITY_r00 866
+#define _CHECK_VALIDITY_r11 867
+#define _CHECK_VALIDITY_r22 868
+#define _CHECK_VALIDITY_r33 869
+#define _COLD_DYNAMIC_EXIT_r00 870
+#define _COLD_EXIT_r00 871
+#define _COMPARE_OP_r21 872
+#define _COMPARE_OP_FLOAT_r03 873
+#define _COMPARE_OP_FLOAT_r13 874
+#define _COMPARE_OP_FLOAT_r23 875
+#define _COMPARE_OP_INT_r23 876
+#define _COMPARE_OP_STR_r23 877
+#define _CONTAINS_OP_r23 878
+#define _CONTAINS_OP_DICT_r23 879
+#define _CONTAINS_OP_SET_r23 880
+#define _CONVERT_VALUE_r11 881
+#define _COPY_r01 882
+#define _COPY_1_r02 883
+#define _COPY_1_r12 884
+#define _COPY_1_r23 885
+#define _COPY_2_r03 886
+#define _COPY_2_r13 887
+#define _COPY_2_r23 888
+#define _COPY_3_r03 889
+#define _COPY_3_r13 890
+#define _COPY_3_r23 891
+#define _COPY_3_r33 892
+#define _COPY_FREE_VARS_r00 893
+#define _COPY_FREE_VARS_r11 894
+#define _COPY_FREE_VARS_r22 895
+#define _COPY_FREE_VARS_r33 896
+#define _CREATE_INIT_FRAME_r01 897
+#define _DELETE_ATTR_r10 898
+#define _DELETE_DEREF_r00 899
+#define _DELETE_FAST_r00 900
+#define _DELETE_GLOBAL_r00 901
+#define _DELETE_NAME_r00 902
+#define _DELETE_SUBSCR_r20 903
+#define _DEOPT_r00 904
+#define _DEOPT_r10 905
+#define _DEOPT_r20 906
+#define _DEOPT_r30 907
+#define _DICT_MERGE_r11 908
+#define _DICT_UPDATE_r11 909
+#define _DO_CALL_r01 910
+#define _DO_CALL_FUNCTION_EX_r31 911
+#define _DO_CALL_KW_r11 912
+#define _DYNAMIC_EXIT_r00 913
+#define _DYNAMIC_EXIT_r10 914
+#define _DYNAMIC_EXIT_r20 915
+#define _DYNAMIC_EXIT_r30 916
+#define _END_FOR_r10 917
+#define _END_SEND_r31 918
+#define _ERROR_POP_N_r00 919
+#define _EXIT_INIT_CHECK_r10 920
+#define _EXIT_TRACE_r00 921
+#define _EXIT_TRACE_r10 922
+#define _EXIT_TRACE_r20 923
+#define _EXIT_TRACE_r30 924
+#define _EXPAND_METHOD_r00 925
+#define _EXPAND_METHOD_KW_r11 926
+#define _FATAL_ERROR_r00 927
+#define _FATAL_ERROR_r11 928
+#define _FATAL_ERROR_r22 929
+#define _FATAL_ERROR_r33 930
+#define _FORMAT_SIMPLE_r11 931
+#define _FORMAT_WITH_SPEC_r21 932
+#define _FOR_ITER_r23 933
+#define _FOR_ITER_GEN_FRAME_r03 934
+#define _FOR_ITER_GEN_FRAME_r13 935
+#define _FOR_ITER_GEN_FRAME_r23 936
+#define _FOR_ITER_TIER_TWO_r23 937
+#define _FOR_ITER_VIRTUAL_r23 938
+#define _FOR_ITER_VIRTUAL_TIER_TWO_r23 939
+#define _GET_AITER_r11 940
+#define _GET_ANEXT_r12 941
+#define _GET_AWAITABLE_r11 942
+#define _GET_ITER_r12 943
+#define _GET_ITER_TRAD_r12 944
+#define _GET_LEN_r12 945
+#define _GUARD_3OS_ASYNC_GEN_ASEND_r03 946
+#define _GUARD_3OS_ASYNC_GEN_ASEND_r13 947
+#define _GUARD_3OS_ASYNC_GEN_ASEND_r23 948
+#define _GUARD_3OS_ASYNC_GEN_ASEND_r33 949
+#define _GUARD_BINARY_OP_EXTEND_r22 950
+#define _GUARD_BINARY_OP_EXTEND_LHS_r02 951
+#define _GUARD_BINARY_OP_EXTEND_LHS_r12 952
+#define _GUARD_BINARY_OP_EXTEND_LHS_r22 953
+#define _GUARD_BINARY_OP_EXTEND_LHS_r33 954
+#define _GUARD_BINARY_OP_EXTEND_RHS_r02 955
+#define _GUARD_BINARY_OP_EXTEND_RHS_r12 956
+#define _GUARD_BINARY_OP_EXTEND_RHS_r22 957
+#define _GUARD_BINARY_OP_EXTEND_RHS_r33 958
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r02 959
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r12 960
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r22 961
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r33 962
+#define _GUARD_BIT_IS_SET_POP_r00 963
+#define _GUARD_BIT_IS_SET_POP_r10 964
+#define _GUARD_BIT_IS_SET_POP_r21 965
+#define _GUARD_BIT_IS_SET_POP_r32 966
+#define _GUARD_BIT_IS_SET_POP_4_r00 967
+#define _GUARD_BIT_IS_SET_POP_4_r10 968
+#define _GUARD_BIT_IS_SET_POP_4_r21 969
+#define _GUARD_BIT_IS_SET_POP_4_r32 970
+#define _GUARD_BIT_IS_SET_POP_5_r00 971
+#define _GUARD_BIT_IS_SET_POP_5_r10 972
+#define _GUARD_BIT_IS_SET_POP_5_r21 973
+#define _GUARD_BIT_IS_SET_POP_5_r32 974
+#define _GUARD_BIT_IS_SET_POP_6_r00 975
+#define _GUARD_BIT_IS_SET_POP_6_r10 976
+#define _GUARD_BIT_IS_SET_POP_6_r21 977
+#define _GUARD_BIT_IS_SET_POP_6_r32 978
+#define _GUARD_BIT_IS_SET_POP_7_r00 979
+#define _GUARD_BIT_IS_SET_POP_7_r10 980
+#define _GUARD_BIT_IS_SET_POP_7_r21 981
+#define _GUARD_BIT_IS_SET_POP_7_r32 982
+#define _GUARD_BIT_IS_UNSET_POP_r00 983
+#define _GUARD_BIT_IS_UNSET_POP_r10 984
+#define _GUARD_BIT_IS_UNSET_POP_r21 985
+#define _GUARD_BIT_IS_UNSET_POP_r32 986
+#define _GUARD_BIT_IS_UNSET_POP_4_r00 987
+#define _GUARD_BIT_IS_UNSET_POP_4_r10 988
+#define _GUARD_BIT_IS_UNSET_POP_4_r21 989
+#define _GUARD_BIT_IS_UNSET_POP_4_r32 990
+#define _GUARD_BIT_IS_UNSET_POP_5_r00 991
+#define _GUARD_BIT_IS_UNSET_POP_5_r10 992
+#define _GUARD_BIT_IS_UNSET_POP_5_r21 993
+#define _GUARD_BIT_IS_UNSET_POP_5_r32 994
+#define _GUARD_BIT_IS_UNSET_POP_6_r00 995
+#define _GUARD_BIT_IS_UNSET_POP_6_r10 996
+#define _GUARD_BIT_IS_UNSET_POP_6_r21 997
+#define _GUARD_BIT_IS_UNSET_POP_6_r32 998
+#define _GUARD_BIT_IS_UNSET_POP_7_r00 999
+#define _GUARD_BIT_IS_UNSET_POP_7_r10 1000
+#define _GUARD_BIT_IS_UNSET_POP_7_r21 1001
+#define _GUARD_BIT_IS_UNSET_POP_7_r32 1002
+#define _GUARD_CALLABLE_BUILTIN_CLASS_r00 1003
+#define _GUARD_CALLABLE_BUILTIN_CLASS_KW_r11 1004
+#define _GUARD_CALLABLE_BUILTIN_FAST_r00 1005
+#define _GUARD_CALLABLE_BUILTIN_FAST_KW_r11 1006
+#define _GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS_r00 1007
+#define _GUARD_CALLABLE_BUILTIN_O_r00 1008
+#define _GUARD_CALLABLE_ISINSTANCE_r03 1009
+#define _GUARD_CALLABLE_ISINSTANCE_r13 1010
+#define _GUARD_CALLABLE_ISINSTANCE_r23 1011
+#define _GUARD_CALLABLE_ISINSTANCE_r33 1012
+#define _GUARD_CALLABLE_LEN_r03 1013
+#define _GUARD_CALLABLE_LEN_r13 1014
+#define _GUARD_CALLABLE_LEN_r23 1015
+#define _GUARD_CALLABLE_LEN_r33 1016
+#define _GUARD_CALLABLE_LIST_APPEND_r03 1017
+#define _GUARD_CALLABLE_LIST_APPEND_r13 1018
+#define _GUARD_CALLABLE_LIST_APPEND_r23 1019
+#define _GUARD_CALLABLE_LIST_APPEND_r33 1020
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_r00 1021
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW_r11 1022
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r00 1023
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_NOARGS_r00 1024
+#define _GUARD_CALLABLE_METHOD_DESCRIPTOR_O_r00 1025
+#define _GUARD_CALLABLE_STR_1_r03 1026
+#define _GUARD_CALLABLE_STR_1_r13 1027
+#define _GUARD_CALLABLE_STR_1_r23 1028
+#define _GUARD_CALLABLE_STR_1_r33 1029
+#define _GUARD_CALLABLE_TUPLE_1_r03 1030
+#define _GUARD_CALLABLE_TUPLE_1_r13 1031
+#define _GUARD_CALLABLE_TUPLE_1_r23 1032
+#define _GUARD_CALLABLE_TUPLE_1_r33 1033
+#define _GUARD_CALLABLE_TYPE_1_r03 1034
+#define _GUARD_CALLABLE_TYPE_1_r13 1035
+#define _GUARD_CALLABLE_TYPE_1_r23 1036
+#define _GUARD_CALLABLE_TYPE_1_r33 1037
+#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r00 1038
+#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r11 1039
+#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r22 1040
+#define _GUARD_CODE_VERSION_RETURN_GENERATOR_r33 1041
+#define _GUARD_CODE_VERSION_RETURN_VALUE_r00 1042
+#define _GUARD_CODE_VERSION_RETURN_VALUE_r11 1043
+#define _GUARD_CODE_VERSION_RETURN_VALUE_r22 1044
+#define _GUARD_CODE_VERSION_RETURN_VALUE_r33 1045
+#define _GUARD_CODE_VERSION_YIELD_VALUE_r00 1046
+#define _GUARD_CODE_VERSION_YIELD_VALUE_r11 1047
+#define _GUARD_CODE_VERSION_YIELD_VALUE_r22 1048
+#define _GUARD_CODE_VERSION_YIELD_VALUE_r33 1049
+#define _GUARD_CODE_VERSION__PUSH_FRAME_r00 1050
+#define _GUARD_CODE_VERSION__PUSH_FRAME_r11 1051
+#define _GUARD_CODE_VERSION__PUSH_FRAME_r22 1052
+#define _GUARD_CODE_VERSION__PUSH_FRAME_r33 1053
+#define _GUARD_DORV_NO_DICT_r01 1054
+#define _GUARD_DORV_NO_DICT_r11 1055
+#define _GUARD_DORV_NO_DICT_r22 1056
+#define _GUARD_DORV_NO_DICT_r33 1057
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01 1058
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11 1059
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22 1060
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33 1061
+#define _GUARD_GLOBALS_VERSION_r00 1062
+#define _GUARD_GLOBALS_VERSION_r11 1063
+#define _GUARD_GLOBALS_VERSION_r22 1064
+#define _GUARD_GLOBALS_VERSION_r33 1065
+#define _GUARD_IP_RETURN_GENERATOR_r00 1066
+#define _GUARD_IP_RETURN_GENERATOR_r11 1067
+#define _GUARD_IP_RETURN_GENERATOR_r22 1068
+#define _GUARD_IP_RETURN_GENERATOR_r33 1069
+#define _GUARD_IP_RETURN_VALUE_r00 1070
+#define _GUARD_IP_RETURN_VALUE_r11 1071
+#define _GUARD_IP_RETURN_VALUE_r22 1072
+#define _GUARD_IP_RETURN_VALUE_r33 1073
+#define _GUARD_IP_YIELD_VALUE_r00 1074
+#define _GUARD_IP_YIELD_VALUE_r11 1075
+#define _GUARD_IP_YIELD_VALUE_r22 1076
+#define _GUARD_IP_YIELD_VALUE_r33 1077
+#define _GUARD_IP__PUSH_FRAME_r00 1078
+#define _GUARD_IP__PUSH_FRAME_r11 1079
+#define _GUARD_IP__PUSH_FRAME_r22 1080
+#define _GUARD_IP__PUSH_FRAME_r33 1081
+#define _GUARD_IS_FALSE_POP_r00 1082
+#define _GUARD_IS_FALSE_POP_r10 1083
+#define _GUARD_IS_FALSE_POP_r21 1084
+#define _GUARD_IS_FALSE_POP_r32 1085
+#define _GUARD_IS_NONE_POP_r00 1086
+#define _GUARD_IS_NONE_POP_r10 1087
+#define _GUARD_IS_NONE_POP_r21 1088
+#define _GUARD_IS_NONE_POP_r32 1089
+#define _GUARD_IS_NOT_NONE_POP_r10 1090
+#define _GUARD_IS_TRUE_POP_r00 1091
+#define _GUARD_IS_TRUE_POP_r10 1092
+#define _GUARD_IS_TRUE_POP_r21 1093
+#define _GUARD_IS_TRUE_POP_r32 1094
+#define _GUARD_ITERATOR_r01 1095
+#define _GUARD_ITERATOR_r11 1096
+#define _GUARD_ITERATOR_r22 1097
+#define _GUARD_ITERATOR_r33 1098
+#define _GUARD_ITER_VIRTUAL_r01 1099
+#define _GUARD_ITER_VIRTUAL_r11 1100
+#define _GUARD_ITER_VIRTUAL_r22 1101
+#define _GUARD_ITER_VIRTUAL_r33 1102
+#define _GUARD_KEYS_VERSION_r01 1103
+#define _GUARD_KEYS_VERSION_r11 1104
+#define _GUARD_KEYS_VERSION_r22 1105
+#define _GUARD_KEYS_VERSION_r33 1106
+#define _GUARD_LOAD_SUPER_ATTR_METHOD_r03 1107
+#define _GUARD_LOAD_SUPER_ATTR_METHOD_r13 1108
+#define _GUARD_LOAD_SUPER_ATTR_METHOD_r23 1109
+#define _GUARD_LOAD_SUPER_ATTR_METHOD_r33 1110
+#define _GUARD_NOS_COMPACT_ASCII_r02 1111
+#define _GUARD_NOS_COMPACT_ASCII_r12 1112
+#define _GUARD_NOS_COMPACT_ASCII_r22 1113
+#define _GUARD_NOS_COMPACT_ASCII_r33 1114
+#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r03 1115
+#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r13 1116
+#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r23 1117
+#define _GUARD_NOS_DICT_STORE_SUBSCRIPT_r33 1118
+#define _GUARD_NOS_DICT_SUBSCRIPT_r02 1119
+#define _GUARD_NOS_DICT_SUBSCRIPT_r12 1120
+#define _GUARD_NOS_DICT_SUBSCRIPT_r22 1121
+#define _GUARD_NOS_DICT_SUBSCRIPT_r33 1122
+#define _GUARD_NOS_FLOAT_r02 1123
+#define _GUARD_NOS_FLOAT_r12 1124
+#define _GUARD_NOS_FLOAT_r22 1125
+#define _GUARD_NOS_FLOAT_r33 1126
+#define _GUARD_NOS_INT_r02 1127
+#define _GUARD_NOS_INT_r12 1128
+#define _GUARD_NOS_INT_r22 1129
+#define _GUARD_NOS_INT_r33 1130
+#define _GUARD_NOS_ITER_VIRTUAL_r02 1131
+#define _GUARD_NOS_ITER_VIRTUAL_r12 1132
+#define _GUARD_NOS_ITER_VIRTUAL_r22 1133
+#define _GUARD_NOS_ITER_VIRTUAL_r33 1134
+#define _GUARD_NOS_LIST_r02 1135
+#define _GUARD_NOS_LIST_r12 1136
+#define _GUARD_NOS_LIST_r22 1137
+#define _GUARD_NOS_LIST_r33 1138
+#define _GUARD_NOS_NOT_NULL_r02 1139
+#define _GUARD_NOS_NOT_NULL_r12 1140
+#define _GUARD_NOS_NOT_NULL_r22 1141
+#define _GUARD_NOS_NOT_NULL_r33 1142
+#define _GUARD_NOS_NULL_r02 1143
+#define _GUARD_NOS_NULL_r12 1144
+#define _GUARD_NOS_NULL_r22 1145
+#define _GUARD_NOS_NULL_r33 1146
+#define _GUARD_NOS_OVERFLOWED_r02 1147
+#define _GUARD_NOS_OVERFLOWED_r12 1148
+#define _GUARD_NOS_OVERFLOWED_r22 1149
+#define _GUARD_NOS_OVERFLOWED_r33 1150
+#define _GUARD_NOS_TUPLE_r02 1151
+#define _GUARD_NOS_TUPLE_r12 1152
+#define _GUARD_NOS_TUPLE_r22 1153
+#define _GUARD_NOS_TUPLE_r33 1154
+#define _GUARD_NOS_TYPE_VERSION_r02 1155
+#define _GUARD_NOS_TYPE_VERSION_r12 1156
+#define _GUARD_NOS_TYPE_VERSION_r22 1157
+#define _GUARD_NOS_TYPE_VERSION_r33 1158
+#define _GUARD_NOS_UNICODE_r02 1159
+#define _GUARD_NOS_UNICODE_r12 1160
+#define _GUARD_NOS_UNICODE_r22 1161
+#define _GUARD_NOS_UNICODE_r33 1162
+#define _GUARD_NOT_EXHAUSTED_LIST_r02 1163
+#define _GUARD_NOT_EXHAUSTED_LIST_r12 1164
+#define _GUARD_NOT_EXHAUSTED_LIST_r22 1165
+#define _GUARD_NOT_EXHAUSTED_LIST_r33 1166
+#define _GUARD_NOT_EXHAUSTED_RANGE_r02 1167
+#define _GUARD_NOT_EXHAUSTED_RANGE_r12 1168
+#define _GUARD_NOT_EXHAUSTED_RANGE_r22 1169
+#define _GUARD_NOT_EXHAUSTED_RANGE_r33 1170
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r02 1171
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r12 1172
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r22 1173
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r33 1174
+#define _GUARD_THIRD_NULL_r03 1175
+#define _GUARD_THIRD_NULL_r13 1176
+#define _GUARD_THIRD_NULL_r23 1177
+#define _GUARD_THIRD_NULL_r33 1178
+#define _GUARD_TOS_ANY_DICT_r01 1179
+#define _GUARD_TOS_ANY_DICT_r11 1180
+#define _GUARD_TOS_ANY_DICT_r22 1181
+#define _GUARD_TOS_ANY_DICT_r33 1182
+#define _GUARD_TOS_ANY_SET_r01 1183
+#define _GUARD_TOS_ANY_SET_r11 1184
+#define _GUARD_TOS_ANY_SET_r22 1185
+#define _GUARD_TOS_ANY_SET_r33 1186
+#define _GUARD_TOS_DICT_r01 1187
+#define _GUARD_TOS_DICT_r11 1188
+#define _GUARD_TOS_DICT_r22 1189
+#define _GUARD_TOS_DICT_r33 1190
+#define _GUARD_TOS_FLOAT_r01 1191
+#define _GUARD_TOS_FLOAT_r11 1192
+#define _GUARD_TOS_FLOAT_r22 1193
+#define _GUARD_TOS_FLOAT_r33 1194
+#define _GUARD_TOS_FROZENDICT_r01 1195
+#define _GUARD_TOS_FROZENDICT_r11 1196
+#define _GUARD_TOS_FROZENDICT_r22 1197
+#define _GUARD_TOS_FROZENDICT_r33 1198
+#define _GUARD_TOS_FROZENSET_r01 1199
+#define _GUARD_TOS_FROZENSET_r11 1200
+#define _GUARD_TOS_FROZENSET_r22 1201
+#define _GUARD_TOS_FROZENSET_r33 1202
+#define _GUARD_TOS_INT_r01 1203
+#define _GUARD_TOS_INT_r11 1204
+#define _GUARD_TOS_INT_r22 1205
+#define _GUARD_TOS_INT_r33 1206
+#define _GUARD_TOS_IS_NONE_r01 1207
+#define _GUARD_TOS_IS_NONE_r11 1208
+#define _GUARD_TOS_IS_NONE_r22 1209
+#define _GUARD_TOS_IS_NONE_r33 1210
+#define _GUARD_TOS_LIST_r01 1211
+#define _GUARD_TOS_LIST_r11 1212
+#define _GUARD_TOS_LIST_r22 1213
+#define _GUARD_TOS_LIST_r33 1214
+#define _GUARD_TOS_NOT_NULL_r01 1215
+#define _GUARD_TOS_NOT_NULL_r11 1216
+#define _GUARD_TOS_NOT_NULL_r22 1217
+#define _GUARD_TOS_NOT_NULL_r33 1218
+#define _GUARD_TOS_OVERFLOWED_r01 1219
+#define _GUARD_TOS_OVERFLOWED_r11 1220
+#define _GUARD_TOS_OVERFLOWED_r22 1221
+#define _GUARD_TOS_OVERFLOWED_r33 1222
+#define _GUARD_TOS_SET_r01 1223
+#define _GUARD_TOS_SET_r11 1224
+#define _GUARD_TOS_SET_r22 1225
+#define _GUARD_TOS_SET_r33 1226
+#define _GUARD_TOS_SLICE_r01 1227
+#define _GUARD_TOS_SLICE_r11 1228
+#define _GUARD_TOS_SLICE_r22 1229
+#define _GUARD_TOS_SLICE_r33 1230
+#define _GUARD_TOS_TUPLE_r01 1231
+#define _GUARD_TOS_TUPLE_r11 1232
+#define _GUARD_TOS_TUPLE_r22 1233
+#define _GUARD_TOS_TUPLE_r33 1234
+#define _GUARD_TOS_UNICODE_r01 1235
+#define _GUARD_TOS_UNICODE_r11 1236
+#define _GUARD_TOS_UNICODE_r22 1237
+#define _GUARD_TOS_UNICODE_r33 1238
+#define _GUARD_TYPE_r01 1239
+#define _GUARD_TYPE_r11 1240
+#define _GUARD_TYPE_r22 1241
+#define _GUARD_TYPE_r33 1242
+#define _GUARD_TYPE_ITER_r02 1243
+#define _GUARD_TYPE_ITER_r12 1244
+#define _GUARD_TYPE_ITER_r22 1245
+#define _GUARD_TYPE_ITER_r33 1246
+#define _GUARD_TYPE_VERSION_r01 1247
+#define _GUARD_TYPE_VERSION_r11 1248
+#define _GUARD_TYPE_VERSION_r22 1249
+#define _GUARD_TYPE_VERSION_r33 1250
+#define _GUARD_TYPE_VERSION_LOCKED_r01 1251
+#define _GUARD_TYPE_VERSION_LOCKED_r11 1252
+#define _GUARD_TYPE_VERSION_LOCKED_r22 1253
+#define _GUARD_TYPE_VERSION_LOCKED_r33 1254
+#define _HANDLE_PENDING_AND_DEOPT_r00 1255
+#define _HANDLE_PENDING_AND_DEOPT_r10 1256
+#define _HANDLE_PENDING_AND_DEOPT_r20 1257
+#define _HANDLE_PENDING_AND_DEOPT_r30 1258
+#define _IMPORT_FROM_r12 1259
+#define _IMPORT_NAME_r21 1260
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS_r00 1261
+#define _INIT_CALL_PY_EXACT_ARGS_r01 1262
+#define _INIT_CALL_PY_EXACT_ARGS_0_r01 1263
+#define _INIT_CALL_PY_EXACT_ARGS_1_r01 1264
+#define _INIT_CALL_PY_EXACT_ARGS_2_r01 1265
+#define _INIT_CALL_PY_EXACT_ARGS_3_r01 1266
+#define _INIT_CALL_PY_EXACT_ARGS_4_r01 1267
+#define _INSERT_NULL_r10 1268
+#define _INSTRUMENTED_FOR_ITER_r23 1269
+#define _INSTRUMENTED_INSTRUCTION_r00 1270
+#define _INSTRUMENTED_JUMP_FORWARD_r00 1271
+#define _INSTRUMENTED_JUMP_FORWARD_r11 1272
+#define _INSTRUMENTED_JUMP_FORWARD_r22 1273
+#define _INSTRUMENTED_JUMP_FORWARD_r33 1274
+#define _INSTRUMENTED_LINE_r00 1275
+#define _INSTRUMENTED_NOT_TAKEN_r00 1276
+#define _INSTRUMENTED_NOT_TAKEN_r11 1277
+#define _INSTRUMENTED_NOT_TAKEN_r22 1278
+#define _INSTRUMENTED_NOT_TAKEN_r33 1279
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r00 1280
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r10 1281
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r21 1282
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r32 1283
+#define _INSTRUMENTED_POP_JUMP_IF_NONE_r10 1284
+#define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE_r10 1285
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r00 1286
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r10 1287
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r21 1288
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r32 1289
+#define _IS_NONE_r11 1290
+#define _IS_OP_r03 1291
+#define _IS_OP_r13 1292
+#define _IS_OP_r23 1293
+#define _ITER_CHECK_LIST_r02 1294
+#define _ITER_CHECK_LIST_r12 1295
+#define _ITER_CHECK_LIST_r22 1296
+#define _ITER_CHECK_LIST_r33 1297
+#define _ITER_CHECK_RANGE_r02 1298
+#define _ITER_CHECK_RANGE_r12 1299
+#define _ITER_CHECK_RANGE_r22 1300
+#define _ITER_CHECK_RANGE_r33 1301
+#define _ITER_CHECK_TUPLE_r02 1302
+#define _ITER_CHECK_TUPLE_r12 1303
+#define _ITER_CHECK_TUPLE_r22 1304
+#define _ITER_CHECK_TUPLE_r33 1305
+#define _ITER_JUMP_LIST_r02 1306
+#define _ITER_JUMP_LIST_r12 1307
+#define _ITER_JUMP_LIST_r22 1308
+#define _ITER_JUMP_LIST_r33 1309
+#define _ITER_JUMP_RANGE_r02 1310
+#define _ITER_JUMP_RANGE_r12 1311
+#define _ITER_JUMP_RANGE_r22 1312
+#define _ITER_JUMP_RANGE_r33 1313
+#define _ITER_JUMP_TUPLE_r02 1314
+#define _ITER_JUMP_TUPLE_r12 1315
+#define _ITER_JUMP_TUPLE_r22 1316
+#define _ITER_JUMP_TUPLE_r33 1317
+#define _ITER_NEXT_INLINE_r23 1318
+#define _ITER_NEXT_LIST_r23 1319
+#define _ITER_NEXT_LIST_TIER_TWO_r23 1320
+#define _ITER_NEXT_RANGE_r03 1321
+#define _ITER_NEXT_RANGE_r13 1322
+#define _ITER_NEXT_RANGE_r23 1323
+#define _ITER_NEXT_TUPLE_r03 1324
+#define _ITER_NEXT_TUPLE_r13 1325
+#define _ITER_NEXT_TUPLE_r23 1326
+#define _JUMP_BACKWARD_NO_INTERRUPT_r00 1327
+#define _JUMP_BACKWARD_NO_INTERRUPT_r11 1328
+#define _JUMP_BACKWARD_NO_INTERRUPT_r22 1329
+#define _JUMP_BACKWARD_NO_INTERRUPT_r33 1330
+#define _JUMP_TO_TOP_r00 1331
+#define _LIST_APPEND_r10 1332
+#define _LIST_EXTEND_r11 1333
+#define _LOAD_ATTR_r10 1334
+#define _LOAD_ATTR_CLASS_r11 1335
+#define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN_FRAME_r11 1336
+#define _LOAD_ATTR_INSTANCE_VALUE_r02 1337
+#define _LOAD_ATTR_INSTANCE_VALUE_r12 1338
+#define _LOAD_ATTR_INSTANCE_VALUE_r23 1339
+#define _LOAD_ATTR_METHOD_LAZY_DICT_r02 1340
+#define _LOAD_ATTR_METHOD_LAZY_DICT_r12 1341
+#define _LOAD_ATTR_METHOD_LAZY_DICT_r23 1342
+#define _LOAD_ATTR_METHOD_NO_DICT_r02 1343
+#define _LOAD_ATTR_METHOD_NO_DICT_r12 1344
+#define _LOAD_ATTR_METHOD_NO_DICT_r23 1345
+#define _LOAD_ATTR_METHOD_WITH_VALUES_r02 1346
+#define _LOAD_ATTR_METHOD_WITH_VALUES_r12 1347
+#define _LOAD_ATTR_METHOD_WITH_VALUES_r23 1348
+#define _LOAD_ATTR_MODULE_r12 1349
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11 1350
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11 1351
+#define _LOAD_ATTR_PROPERTY_FRAME_r01 1352
+#define _LOAD_ATTR_PROPERTY_FRAME_r11 1353
+#define _LOAD_ATTR_PROPERTY_FRAME_r22 1354
+#define _LOAD_ATTR_PROPERTY_FRAME_r33 1355
+#define _LOAD_ATTR_SLOT_r02 1356
+#define _LOAD_ATTR_SLOT_r12 1357
+#define _LOAD_ATTR_SLOT_r23 1358
+#define _LOAD_ATTR_WITH_HINT_r12 1359
+#define _LOAD_BUILD_CLASS_r01 1360
+#define _LOAD_BYTECODE_r00 1361
+#define _LOAD_COMMON_CONSTANT_r01 1362
+#define _LOAD_COMMON_CONSTANT_r12 1363
+#define _LOAD_COMMON_CONSTANT_r23 1364
+#define _LOAD_CONST_r01 1365
+#define _LOAD_CONST_r12 1366
+#define _LOAD_CONST_r23 1367
+#define _LOAD_CONST_INLINE_r01 1368
+#define _LOAD_CONST_INLINE_r12 1369
+#define _LOAD_CONST_INLINE_r23 1370
+#define _LOAD_CONST_INLINE_BORROW_r01 1371
+#define _LOAD_CONST_INLINE_BORROW_r12 1372
+#define _LOAD_CONST_INLINE_BORROW_r23 1373
+#define _LOAD_DEREF_r01 1374
+#define _LOAD_FAST_r01 1375
+#define _LOAD_FAST_r12 1376
+#define _LOAD_FAST_r23 1377
+#define _LOAD_FAST_0_r01 1378
+#define _LOAD_FAST_0_r12 1379
+#define _LOAD_FAST_0_r23 1380
+#define _LOAD_FAST_1_r01 1381
+#define _LOAD_FAST_1_r12 1382
+#define _LOAD_FAST_1_r23 1383
+#define _LOAD_FAST_2_r01 1384
+#define _LOAD_FAST_2_r12 1385
+#define _LOAD_FAST_2_r23 1386
+#define _LOAD_FAST_3_r01 1387
+#define _LOAD_FAST_3_r12 1388
+#define _LOAD_FAST_3_r23 1389
+#define _LOAD_FAST_4_r01 1390
+#define _LOAD_FAST_4_r12 1391
+#define _LOAD_FAST_4_r23 1392
+#define _LOAD_FAST_5_r01 1393
+#define _LOAD_FAST_5_r12 1394
+#define _LOAD_FAST_5_r23 1395
+#define _LOAD_FAST_6_r01 1396
+#define _LOAD_FAST_6_r12 1397
+#define _LOAD_FAST_6_r23 1398
+#define _LOAD_FAST_7_r01 1399
+#define _LOAD_FAST_7_r12 1400
+#define _LOAD_FAST_7_r23 1401
+#define _LOAD_FAST_AND_CLEAR_r01 1402
+#define _LOAD_FAST_AND_CLEAR_r12 1403
+#define _LOAD_FAST_AND_CLEAR_r23 1404
+#define _LOAD_FAST_BORROW_r01 1405
+#define _LOAD_FAST_BORROW_r12 1406
+#define _LOAD_FAST_BORROW_r23 1407
+#define _LOAD_FAST_BORROW_0_r01 1408
+#define _LOAD_FAST_BORROW_0_r12 1409
+#define _LOAD_FAST_BORROW_0_r23 1410
+#define _LOAD_FAST_BORROW_1_r01 1411
+#define _LOAD_FAST_BORROW_1_r12 1412
+#define _LOAD_FAST_BORROW_1_r23 1413
+#define _LOAD_FAST_BORROW_2_r01 1414
+#define _LOAD_FAST_BORROW_2_r12 1415
+#define _LOAD_FAST_BORROW_2_r23 1416
+#define _LOAD_FAST_BORROW_3_r01 1417
+#define _LOAD_FAST_BORROW_3_r12 1418
+#define _LOAD_FAST_BORROW_3_r23 1419
+#define _LOAD_FAST_BORROW_4_r01 1420
+#define _LOAD_FAST_BORROW_4_r12 1421
+#define _LOAD_FAST_BORROW_4_r23 1422
+#define _LOAD_FAST_BORROW_5_r01 1423
+#define _LOAD_FAST_BORROW_5_r12 1424
+#define _LOAD_FAST_BORROW_5_r23 1425
+#define _LOAD_FAST_BORROW_6_r01 1426
+#define _LOAD_FAST_BORROW_6_r12 1427
+#define _LOAD_FAST_BORROW_6_r23 1428
+#define _LOAD_FAST_BORROW_7_r01 1429
+#define _LOAD_FAST_BORROW_7_r12 1430
+#define _LOAD_FAST_BORROW_7_r23 1431
+#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r02 1432
+#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r13 1433
+#define _LOAD_FAST_CHECK_r01 1434
+#define _LOAD_FAST_CHECK_r12 1435
+#define _LOAD_FAST_CHECK_r23 1436
+#define _LOAD_FAST_LOAD_FAST_r02 1437
+#define _LOAD_FAST_LOAD_FAST_r13 1438
+#define _LOAD_FROM_DICT_OR_DEREF_r11 1439
+#define _LOAD_FROM_DICT_OR_GLOBALS_r11 1440
+#define _LOAD_GLOBAL_r00 1441
+#define _LOAD_GLOBAL_BUILTINS_r01 1442
+#define _LOAD_GLOBAL_MODULE_r01 1443
+#define _LOAD_LOCALS_r01 1444
+#define _LOAD_LOCALS_r12 1445
+#define _LOAD_LOCALS_r23 1446
+#define _LOAD_NAME_r01 1447
+#define _LOAD_SMALL_INT_r01 1448
+#define _LOAD_SMALL_INT_r12 1449
+#define _LOAD_SMALL_INT_r23 1450
+#define _LOAD_SMALL_INT_0_r01 1451
+#define _LOAD_SMALL_INT_0_r12 1452
+#define _LOAD_SMALL_INT_0_r23 1453
+#define _LOAD_SMALL_INT_1_r01 1454
+#define _LOAD_SMALL_INT_1_r12 1455
+#define _LOAD_SMALL_INT_1_r23 1456
+#define _LOAD_SMALL_INT_2_r01 1457
+#define _LOAD_SMALL_INT_2_r12 1458
+#define _LOAD_SMALL_INT_2_r23 1459
+#define _LOAD_SMALL_INT_3_r01 1460
+#define _LOAD_SMALL_INT_3_r12 1461
+#define _LOAD_SMALL_INT_3_r23 1462
+#define _LOAD_SPECIAL_r00 1463
+#define _LOAD_SUPER_ATTR_ATTR_r31 1464
+#define _LOAD_SUPER_ATTR_METHOD_r32 1465
+#define _LOCK_OBJECT_r01 1466
+#define _LOCK_OBJECT_r11 1467
+#define _LOCK_OBJECT_r22 1468
+#define _LOCK_OBJECT_r33 1469
+#define _LOOP_HEAD_r00 1470
+#define _MAKE_CALLARGS_A_TUPLE_r33 1471
+#define _MAKE_CELL_r00 1472
+#define _MAKE_FUNCTION_r12 1473
+#define _MAKE_HEAP_SAFE_r01 1474
+#define _MAKE_HEAP_SAFE_r11 1475
+#define _MAKE_HEAP_SAFE_r22 1476
+#define _MAKE_HEAP_SAFE_r33 1477
+#define _MAKE_WARM_r00 1478
+#define _MAKE_WARM_r11 1479
+#define _MAKE_WARM_r22 1480
+#define _MAKE_WARM_r33 1481
+#define _MAP_ADD_r20 1482
+#define _MATCH_CLASS_r33 1483
+#define _MATCH_KEYS_r23 1484
+#define _MATCH_MAPPING_r02 1485
+#define _MATCH_MAPPING_r12 1486
+#define _MATCH_MAPPING_r23 1487
+#define _MATCH_SEQUENCE_r02 1488
+#define _MATCH_SEQUENCE_r12 1489
+#define _MATCH_SEQUENCE_r23 1490
+#define _MAYBE_EXPAND_METHOD_r00 1491
+#define _MAYBE_EXPAND_METHOD_KW_r11 1492
+#define _MONITOR_CALL_r00 1493
+#define _MONITOR_CALL_KW_r11 1494
+#define _MONITOR_JUMP_BACKWARD_r00 1495
+#define _MONITOR_JUMP_BACKWARD_r11 1496
+#define _MONITOR_JUMP_BACKWARD_r22 1497
+#define _MONITOR_JUMP_BACKWARD_r33 1498
+#define _MONITOR_RESUME_r00 1499
+#define _NOP_r00 1500
+#define _NOP_r11 1501
+#define _NOP_r22 1502
+#define _NOP_r33 1503
+#define _POP_EXCEPT_r10 1504
+#define _POP_ITER_r20 1505
+#define _POP_JUMP_IF_FALSE_r00 1506
+#define _POP_JUMP_IF_FALSE_r10 1507
+#define _POP_JUMP_IF_FALSE_r21 1508
+#define _POP_JUMP_IF_FALSE_r32 1509
+#define _POP_JUMP_IF_TRUE_r00 1510
+#define _POP_JUMP_IF_TRUE_r10 1511
+#define _POP_JUMP_IF_TRUE_r21 1512
+#define _POP_JUMP_IF_TRUE_r32 1513
+#define _POP_TOP_r10 1514
+#define _POP_TOP_FLOAT_r00 1515
+#define _POP_TOP_FLOAT_r10 1516
+#define _POP_TOP_FLOAT_r21 1517
+#define _POP_TOP_FLOAT_r32 1518
+#define _POP_TOP_INT_r00 1519
+#define _POP_TOP_INT_r10 1520
+#define _POP_TOP_INT_r21 1521
+#define _POP_TOP_INT_r32 1522
+#define _POP_TOP_NOP_r00 1523
+#define _POP_TOP_NOP_r10 1524
+#define _POP_TOP_NOP_r21 1525
+#define _POP_TOP_NOP_r32 1526
+#define _POP_TOP_OPARG_r00 1527
+#define _POP_TOP_UNICODE_r00 1528
+#define _POP_TOP_UNICODE_r10 1529
+#define _POP_TOP_UNICODE_r21 1530
+#define _POP_TOP_UNICODE_r32 1531
+#define _PUSH_EXC_INFO_r02 1532
+#define _PUSH_EXC_INFO_r12 1533
+#define _PUSH_EXC_INFO_r23 1534
+#define _PUSH_FRAME_r10 1535
+#define _PUSH_NULL_r01 1536
+#define _PUSH_NULL_r12 1537
+#define _PUSH_NULL_r23 1538
+#define _PUSH_NULL_CONDITIONAL_r00 1539
+#define _PUSH_TAGGED_ZERO_r01 1540
+#define _PUSH_TAGGED_ZERO_r12 1541
+#define _PUSH_TAGGED_ZERO_r23 1542
+#define _PY_FRAME_EX_r31 1543
+#define _PY_FRAME_GENERAL_r01 1544
+#define _PY_FRAME_KW_r11 1545
+#define _REPLACE_WITH_TRUE_r02 1546
+#define _REPLACE_WITH_TRUE_r12 1547
+#define _REPLACE_WITH_TRUE_r23 1548
+#define _RESUME_CHECK_r00 1549
+#define _RESUME_CHECK_r11 1550
+#define _RESUME_CHECK_r22 1551
+#define _RESUME_CHECK_r33 1552
+#define _RETURN_GENERATOR_r01 1553
+#define _RETURN_VALUE_r11 1554
+#define _RROT_3_r03 1555
+#define _RROT_3_r13 1556
+#define _RROT_3_r23 1557
+#define _RROT_3_r33 1558
+#define _SAVE_RETURN_OFFSET_r00 1559
+#define _SAVE_RETURN_OFFSET_r11 1560
+#define _SAVE_RETURN_OFFSET_r22 1561
+#define _SAVE_RETURN_OFFSET_r33 1562
+#define _SEND_ASYNC_GEN_r33 1563
+#define _SEND_ASYNC_GEN_TIER_TWO_r33 1564
+#define _SEND_GEN_FRAME_r33 1565
+#define _SEND_VIRTUAL_r33 1566
+#define _SEND_VIRTUAL_TIER_TWO_r03 1567
+#define _SEND_VIRTUAL_TIER_TWO_r13 1568
+#define _SEND_VIRTUAL_TIER_TWO_r23 1569
+#define _SEND_VIRTUAL_TIER_TWO_r33 1570
+#define _SETUP_ANNOTATIONS_r00 1571
+#define _SET_ADD_r10 1572
+#define _SET_FUNCTION_ATTRIBUTE_r01 1573
+#define _SET_FUNCTION_ATTRIBUTE_r11 1574
+#define _SET_FUNCTION_ATTRIBUTE_r21 1575
+#define _SET_FUNCTION_ATTRIBUTE_r32 1576
+#define _SET_IP_r00 1577
+#define _SET_IP_r11 1578
+#define _SET_IP_r22 1579
+#define _SET_IP_r33 1580
+#define _SET_UPDATE_r11 1581
+#define _SPILL_OR_RELOAD_r01 1582
+#define _SPILL_OR_RELOAD_r02 1583
+#define _SPILL_OR_RELOAD_r03 1584
+#define _SPILL_OR_RELOAD_r10 1585
+#define _SPILL_OR_RELOAD_r12 1586
+#define _SPILL_OR_RELOAD_r13 1587
+#define _SPILL_OR_RELOAD_r20 1588
+#define _SPILL_OR_RELOAD_r21 1589
+#define _SPILL_OR_RELOAD_r23 1590
+#define _SPILL_OR_RELOAD_r30 1591
+#define _SPILL_OR_RELOAD_r31 1592
+#define _SPILL_OR_RELOAD_r32 1593
+#define _START_EXECUTOR_r00 1594
+#define _STORE_ATTR_r20 1595
+#define _STORE_ATTR_INSTANCE_VALUE_r21 1596
+#define _STORE_ATTR_SLOT_r21 1597
+#define _STORE_ATTR_WITH_HINT_r21 1598
+#define _STORE_DEREF_r10 1599
+#define _STORE_FAST_LOAD_FAST_r11 1600
+#define _STORE_FAST_STORE_FAST_r20 1601
+#define _STORE_GLOBAL_r10 1602
+#define _STORE_NAME_r10 1603
+#define _STORE_SLICE_r30 1604
+#define _STORE_SUBSCR_r30 1605
+#define _STORE_SUBSCR_DICT_r31 1606
+#define _STORE_SUBSCR_DICT_KNOWN_HASH_r31 1607
+#define _STORE_SUBSCR_LIST_INT_r32 1608
+#define _SWAP_r11 1609
+#define _SWAP_2_r02 1610
+#define _SWAP_2_r12 1611
+#define _SWAP_2_r22 1612
+#define _SWAP_2_r33 1613
+#define _SWAP_3_r03 1614
+#define _SWAP_3_r13 1615
+#define _SWAP_3_r23 1616
+#define _SWAP_3_r33 1617
+#define _SWAP_FAST_r01 1618
+#define _SWAP_FAST_r11 1619
+#define _SWAP_FAST_r22 1620
+#define _SWAP_FAST_r33 1621
+#define _SWAP_FAST_0_r01 1622
+#define _SWAP_FAST_0_r11 1623
+#define _SWAP_FAST_0_r22 1624
+#define _SWAP_FAST_0_r33 1625
+#define _SWAP_FAST_1_r01 1626
+#define _SWAP_FAST_1_r11 1627
+#define _SWAP_FAST_1_r22 1628
+#define _SWAP_FAST_1_r33 1629
+#define _SWAP_FAST_2_r01 1630
+#define _SWAP_FAST_2_r11 1631
+#define _SWAP_FAST_2_r22 1632
+#define _SWAP_FAST_2_r33 1633
+#define _SWAP_FAST_3_r01 1634
+#define _SWAP_FAST_3_r11 1635
+#define _SWAP_FAST_3_r22 1636
+#define _SWAP_FAST_3_r33 1637
+#define _SWAP_FAST_4_r01 1638
+#define _SWAP_FAST_4_r11 1639
+#define _SWAP_FAST_4_r22 1640
+#define _SWAP_FAST_4_r33 1641
+#define _SWAP_FAST_5_r01 1642
+#define _SWAP_FAST_5_r11 1643
+#define _SWAP_FAST_5_r22 1644
+#define _SWAP_FAST_5_r33 1645
+#define _SWAP_FAST_6_r01 1646
+#define _SWAP_FAST_6_r11 1647
+#define _SWAP_FAST_6_r22 1648
+#define _SWAP_FAST_6_r33 1649
+#define _SWAP_FAST_7_r01 1650
+#define _SWAP_FAST_7_r11 1651
+#define _SWAP_FAST_7_r22 1652
+#define _SWAP_FAST_7_r33 1653
+#define _TIER2_RESUME_CHECK_r00 1654
+#define _TIER2_RESUME_CHECK_r11 1655
+#define _TIER2_RESUME_CHECK_r22 1656
+#define _TIER2_RESUME_CHECK_r33 1657
+#define _TO_BOOL_r11 1658
+#define _TO_BOOL_BOOL_r01 1659
+#define _TO_BOOL_BOOL_r11 1660
+#define _TO_BOOL_BOOL_r22 1661
+#define _TO_BOOL_BOOL_r33 1662
+#define _TO_BOOL_INT_r02 1663
+#define _TO_BOOL_INT_r12 1664
+#define _TO_BOOL_INT_r23 1665
+#define _TO_BOOL_LIST_r02 1666
+#define _TO_BOOL_LIST_r12 1667
+#define _TO_BOOL_LIST_r23 1668
+#define _TO_BOOL_NONE_r01 1669
+#define _TO_BOOL_NONE_r11 1670
+#define _TO_BOOL_NONE_r22 1671
+#define _TO_BOOL_NONE_r33 1672
+#define _TO_BOOL_STR_r02 1673
+#define _TO_BOOL_STR_r12 1674
+#define _TO_BOOL_STR_r23 1675
+#define _TRACE_RECORD_r00 1676
+#define _UNARY_INVERT_r12 1677
+#define _UNARY_NEGATIVE_r12 1678
+#define _UNARY_NEGATIVE_FLOAT_INPLACE_r02 1679
+#define _UNARY_NEGATIVE_FLOAT_INPLACE_r12 1680
+#define _UNARY_NEGATIVE_FLOAT_INPLACE_r23 1681
+#define _UNARY_NOT_r01 1682
+#define _UNARY_NOT_r11 1683
+#define _UNARY_NOT_r22 1684
+#define _UNARY_NOT_r33 1685
+#define _UNPACK_EX_r10 1686
+#define _UNPACK_SEQUENCE_r10 1687
+#define _UNPACK_SEQUENCE_LIST_r10 1688
+#define _UNPACK_SEQUENCE_TUPLE_r10 1689
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r12 1690
+#define _UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE_r03 1691
+#define _UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE_r13 1692
+#define _UNPACK_SEQUENCE_UNIQUE_TUPLE_r10 1693
+#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE_r02 1694
+#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE_r12 1695
+#define _UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE_r23 1696
+#define _WITH_EXCEPT_START_r33 1697
+#define _YIELD_VALUE_r11 1698
+#define MAX_UOP_REGS_ID 1698
 
 #ifdef __cplusplus
 }
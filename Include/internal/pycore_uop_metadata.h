@@ -128,7 +128,14 @@ const uint32_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_OP_TRUEDIV_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_OP_TRUEDIV_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
     [_BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE] = 0,
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE] = 0,
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE] = 0,
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT] = 0,
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT] = 0,
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT] = 0,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_UNICODE_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_BINARY_OP_EXTEND_LHS] = HAS_EXIT_FLAG,
     [_GUARD_BINARY_OP_EXTEND_RHS] = HAS_EXIT_FLAG,
@@ -361,6 +368,12 @@ const uint32_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_EXPAND_METHOD_KW] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CALL_KW_NON_PY] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_GUARD_CALLABLE_BUILTIN_CLASS_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
+    [_CALL_KW_BUILTIN_CLASS] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_GUARD_CALLABLE_BUILTIN_FAST_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
+    [_CALL_KW_BUILTIN_FAST] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_CALLARGS_A_TUPLE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_IS_PY_CALLABLE_EX] = HAS_EXIT_FLAG,
     [_PY_FRAME_EX] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG | HAS_SYNC_SP_FLAG,
@@ -396,6 +409,7 @@ const uint32_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_GUARD_IS_NONE_POP] = HAS_EXIT_FLAG,
     [_GUARD_IS_NOT_NONE_POP] = HAS_EXIT_FLAG | HAS_ESCAPES_FLAG,
     [_JUMP_TO_TOP] = 0,
+    [_LOOP_HEAD] = 0,
     [_SET_IP] = 0,
     [_CHECK_STACK_SPACE_OPERAND] = HAS_DEOPT_FLAG,
     [_SAVE_RETURN_OFFSET] = HAS_ARG_FLAG,
@@ -1286,6 +1300,60 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_ADD_FLOAT_INT_INPLACE_r03 },
+            { 3, 1, _BINARY_OP_ADD_FLOAT_INT_INPLACE_r13 },
+            { 3, 2, _BINARY_OP_ADD_FLOAT_INT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r03 },
+            { 3, 1, _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r13 },
+            { 3, 2, _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r03 },
+            { 3, 1, _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r13 },
+            { 3, 2, _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r03 },
+            { 3, 1, _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r13 },
+            { 3, 2, _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r03 },
+            { 3, 1, _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r13 },
+            { 3, 2, _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r03 },
+            { 3, 1, _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r13 },
+            { 3, 2, _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r23 },
+            { -1, -1, -1 },
+        },
+    },
     [_BINARY_OP_ADD_UNICODE] = {
         .best = { 0, 1, 2, 2 },
         .entries = {
@@ -1295,6 +1363,15 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
+    [_BINARY_OP_ADD_UNICODE_INPLACE] = {
+        .best = { 2, 2, 2, 2 },
+        .entries = {
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_ADD_UNICODE_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
     [_BINARY_OP_INPLACE_ADD_UNICODE] = {
         .best = { 2, 2, 2, 2 },
         .entries = {
@@ -3383,6 +3460,60 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
+    [_GUARD_CALLABLE_BUILTIN_CLASS_KW] = {
+        .best = { 1, 1, 1, 1 },
+        .entries = {
+            { -1, -1, -1 },
+            { 1, 1, _GUARD_CALLABLE_BUILTIN_CLASS_KW_r11 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
+    [_CALL_KW_BUILTIN_CLASS] = {
+        .best = { 1, 1, 1, 1 },
+        .entries = {
+            { -1, -1, -1 },
+            { 1, 1, _CALL_KW_BUILTIN_CLASS_r11 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
+    [_GUARD_CALLABLE_BUILTIN_FAST_KW] = {
+        .best = { 1, 1, 1, 1 },
+        .entries = {
+            { -1, -1, -1 },
+            { 1, 1, _GUARD_CALLABLE_BUILTIN_FAST_KW_r11 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
+    [_CALL_KW_BUILTIN_FAST] = {
+        .best = { 1, 1, 1, 1 },
+        .entries = {
+            { -1, -1, -1 },
+            { 1, 1, _CALL_KW_BUILTIN_FAST_r11 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
+    [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW] = {
+        .best = { 1, 1, 1, 1 },
+        .entries = {
+            { -1, -1, -1 },
+            { 1, 1, _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW_r11 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = {
+        .best = { 1, 1, 1, 1 },
+        .entries = {
+            { -1, -1, -1 },
+            { 1, 1, _CALL_KW_METHOD_DESCRIPTOR_FAST_r11 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
     [_MAKE_CALLARGS_A_TUPLE] = {
         .best = { 3, 3, 3, 3 },
         .entries = {
@@ -3698,6 +3829,15 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
+    [_LOOP_HEAD] = {
+        .best = { 0, 0, 0, 0 },
+        .entries = {
+            { 0, 0, _LOOP_HEAD_r00 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+        },
+    },
     [_SET_IP] = {
         .best = { 0, 1, 2, 3 },
         .entries = {
@@ -4222,9 +4362,28 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r03] = _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT,
     [_BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r13] = _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT,
     [_BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT_r23] = _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE_r03] = _BINARY_OP_ADD_FLOAT_INT_INPLACE,
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE_r13] = _BINARY_OP_ADD_FLOAT_INT_INPLACE,
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE_r23] = _BINARY_OP_ADD_FLOAT_INT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r03] = _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r13] = _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r23] = _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE,
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r03] = _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE,
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r13] = _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE,
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r23] = _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE,
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r03] = _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r13] = _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r23] = _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r03] = _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r13] = _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r23] = _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r03] = _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r13] = _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT,
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r23] = _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT,
     [_BINARY_OP_ADD_UNICODE_r03] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_ADD_UNICODE_r13] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_ADD_UNICODE_r23] = _BINARY_OP_ADD_UNICODE,
+    [_BINARY_OP_ADD_UNICODE_INPLACE_r23] = _BINARY_OP_ADD_UNICODE_INPLACE,
     [_BINARY_OP_INPLACE_ADD_UNICODE_r21] = _BINARY_OP_INPLACE_ADD_UNICODE,
     [_GUARD_BINARY_OP_EXTEND_LHS_r02] = _GUARD_BINARY_OP_EXTEND_LHS,
     [_GUARD_BINARY_OP_EXTEND_LHS_r12] = _GUARD_BINARY_OP_EXTEND_LHS,
@@ -4671,6 +4830,12 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_EXPAND_METHOD_KW_r11] = _EXPAND_METHOD_KW,
     [_CHECK_IS_NOT_PY_CALLABLE_KW_r11] = _CHECK_IS_NOT_PY_CALLABLE_KW,
     [_CALL_KW_NON_PY_r11] = _CALL_KW_NON_PY,
+    [_GUARD_CALLABLE_BUILTIN_CLASS_KW_r11] = _GUARD_CALLABLE_BUILTIN_CLASS_KW,
+    [_CALL_KW_BUILTIN_CLASS_r11] = _CALL_KW_BUILTIN_CLASS,
+    [_GUARD_CALLABLE_BUILTIN_FAST_KW_r11] = _GUARD_CALLABLE_BUILTIN_FAST_KW,
+    [_CALL_KW_BUILTIN_FAST_r11] = _CALL_KW_BUILTIN_FAST,
+    [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW_r11] = _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW,
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST_r11] = _CALL_KW_METHOD_DESCRIPTOR_FAST,
     [_MAKE_CALLARGS_A_TUPLE_r33] = _MAKE_CALLARGS_A_TUPLE,
     [_CHECK_IS_PY_CALLABLE_EX_r03] = _CHECK_IS_PY_CALLABLE_EX,
     [_CHECK_IS_PY_CALLABLE_EX_r13] = _CHECK_IS_PY_CALLABLE_EX,
@@ -4767,6 +4932,7 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_GUARD_IS_NONE_POP_r32] = _GUARD_IS_NONE_POP,
     [_GUARD_IS_NOT_NONE_POP_r10] = _GUARD_IS_NOT_NONE_POP,
     [_JUMP_TO_TOP_r00] = _JUMP_TO_TOP,
+    [_LOOP_HEAD_r00] = _LOOP_HEAD,
     [_SET_IP_r00] = _SET_IP,
     [_SET_IP_r11] = _SET_IP,
     [_SET_IP_r22] = _SET_IP,
@@ -4903,10 +5069,18 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r03] = "_BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r03",
     [_BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r13] = "_BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r13",
     [_BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r23] = "_BINARY_OP_ADD_FLOAT_INPLACE_RIGHT_r23",
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE] = "_BINARY_OP_ADD_FLOAT_INT_INPLACE",
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE_r03] = "_BINARY_OP_ADD_FLOAT_INT_INPLACE_r03",
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE_r13] = "_BINARY_OP_ADD_FLOAT_INT_INPLACE_r13",
+    [_BINARY_OP_ADD_FLOAT_INT_INPLACE_r23] = "_BINARY_OP_ADD_FLOAT_INT_INPLACE_r23",
     [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
     [_BINARY_OP_ADD_INT_r03] = "_BINARY_OP_ADD_INT_r03",
     [_BINARY_OP_ADD_INT_r13] = "_BINARY_OP_ADD_INT_r13",
     [_BINARY_OP_ADD_INT_r23] = "_BINARY_OP_ADD_INT_r23",
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT] = "_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT",
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r03] = "_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r03",
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r13] = "_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r13",
+    [_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r23] = "_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT_r23",
     [_BINARY_OP_ADD_INT_INPLACE] = "_BINARY_OP_ADD_INT_INPLACE",
     [_BINARY_OP_ADD_INT_INPLACE_r03] = "_BINARY_OP_ADD_INT_INPLACE_r03",
     [_BINARY_OP_ADD_INT_INPLACE_r13] = "_BINARY_OP_ADD_INT_INPLACE_r13",
@@ -4919,6 +5093,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_ADD_UNICODE_r03] = "_BINARY_OP_ADD_UNICODE_r03",
     [_BINARY_OP_ADD_UNICODE_r13] = "_BINARY_OP_ADD_UNICODE_r13",
     [_BINARY_OP_ADD_UNICODE_r23] = "_BINARY_OP_ADD_UNICODE_r23",
+    [_BINARY_OP_ADD_UNICODE_INPLACE] = "_BINARY_OP_ADD_UNICODE_INPLACE",
+    [_BINARY_OP_ADD_UNICODE_INPLACE_r23] = "_BINARY_OP_ADD_UNICODE_INPLACE_r23",
     [_BINARY_OP_EXTEND] = "_BINARY_OP_EXTEND",
     [_BINARY_OP_EXTEND_r23] = "_BINARY_OP_EXTEND_r23",
     [_BINARY_OP_INPLACE_ADD_UNICODE] = "_BINARY_OP_INPLACE_ADD_UNICODE",
@@ -4935,10 +5111,18 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r03] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r03",
     [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r13] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r13",
     [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r23] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_RIGHT_r23",
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE] = "_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE",
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r03] = "_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r03",
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r13] = "_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r13",
+    [_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r23] = "_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE_r23",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
     [_BINARY_OP_MULTIPLY_INT_r03] = "_BINARY_OP_MULTIPLY_INT_r03",
     [_BINARY_OP_MULTIPLY_INT_r13] = "_BINARY_OP_MULTIPLY_INT_r13",
     [_BINARY_OP_MULTIPLY_INT_r23] = "_BINARY_OP_MULTIPLY_INT_r23",
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT] = "_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT",
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r03] = "_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r03",
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r13] = "_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r13",
+    [_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r23] = "_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT_r23",
     [_BINARY_OP_MULTIPLY_INT_INPLACE] = "_BINARY_OP_MULTIPLY_INT_INPLACE",
     [_BINARY_OP_MULTIPLY_INT_INPLACE_r03] = "_BINARY_OP_MULTIPLY_INT_INPLACE_r03",
     [_BINARY_OP_MULTIPLY_INT_INPLACE_r13] = "_BINARY_OP_MULTIPLY_INT_INPLACE_r13",
@@ -4982,10 +5166,18 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r03] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r03",
     [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r13] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r13",
     [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r23] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_RIGHT_r23",
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE] = "_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE",
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r03] = "_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r03",
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r13] = "_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r13",
+    [_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r23] = "_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE_r23",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
     [_BINARY_OP_SUBTRACT_INT_r03] = "_BINARY_OP_SUBTRACT_INT_r03",
     [_BINARY_OP_SUBTRACT_INT_r13] = "_BINARY_OP_SUBTRACT_INT_r13",
     [_BINARY_OP_SUBTRACT_INT_r23] = "_BINARY_OP_SUBTRACT_INT_r23",
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT] = "_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT",
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r03] = "_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r03",
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r13] = "_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r13",
+    [_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r23] = "_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT_r23",
     [_BINARY_OP_SUBTRACT_INT_INPLACE] = "_BINARY_OP_SUBTRACT_INT_INPLACE",
     [_BINARY_OP_SUBTRACT_INT_INPLACE_r03] = "_BINARY_OP_SUBTRACT_INT_INPLACE_r03",
     [_BINARY_OP_SUBTRACT_INT_INPLACE_r13] = "_BINARY_OP_SUBTRACT_INT_INPLACE_r13",
@@ -5038,6 +5230,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_CALL_INTRINSIC_2_r23] = "_CALL_INTRINSIC_2_r23",
     [_CALL_ISINSTANCE] = "_CALL_ISINSTANCE",
     [_CALL_ISINSTANCE_r31] = "_CALL_ISINSTANCE_r31",
+    [_CALL_KW_BUILTIN_CLASS] = "_CALL_KW_BUILTIN_CLASS",
+    [_CALL_KW_BUILTIN_CLASS_r11] = "_CALL_KW_BUILTIN_CLASS_r11",
+    [_CALL_KW_BUILTIN_FAST] = "_CALL_KW_BUILTIN_FAST",
+    [_CALL_KW_BUILTIN_FAST_r11] = "_CALL_KW_BUILTIN_FAST_r11",
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = "_CALL_KW_METHOD_DESCRIPTOR_FAST",
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST_r11] = "_CALL_KW_METHOD_DESCRIPTOR_FAST_r11",
     [_CALL_KW_NON_PY] = "_CALL_KW_NON_PY",
     [_CALL_KW_NON_PY_r11] = "_CALL_KW_NON_PY_r11",
     [_CALL_LEN] = "_CALL_LEN",
@@ -5347,8 +5545,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_GUARD_BIT_IS_UNSET_POP_7_r32] = "_GUARD_BIT_IS_UNSET_POP_7_r32",
     [_GUARD_CALLABLE_BUILTIN_CLASS] = "_GUARD_CALLABLE_BUILTIN_CLASS",
     [_GUARD_CALLABLE_BUILTIN_CLASS_r00] = "_GUARD_CALLABLE_BUILTIN_CLASS_r00",
+    [_GUARD_CALLABLE_BUILTIN_CLASS_KW] = "_GUARD_CALLABLE_BUILTIN_CLASS_KW",
+    [_GUARD_CALLABLE_BUILTIN_CLASS_KW_r11] = "_GUARD_CALLABLE_BUILTIN_CLASS_KW_r11",
     [_GUARD_CALLABLE_BUILTIN_FAST] = "_GUARD_CALLABLE_BUILTIN_FAST",
     [_GUARD_CALLABLE_BUILTIN_FAST_r00] = "_GUARD_CALLABLE_BUILTIN_FAST_r00",
+    [_GUARD_CALLABLE_BUILTIN_FAST_KW] = "_GUARD_CALLABLE_BUILTIN_FAST_KW",
+    [_GUARD_CALLABLE_BUILTIN_FAST_KW_r11] = "_GUARD_CALLABLE_BUILTIN_FAST_KW_r11",
     [_GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS] = "_GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS",
     [_GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS_r00] = "_GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS_r00",
     [_GUARD_CALLABLE_BUILTIN_O] = "_GUARD_CALLABLE_BUILTIN_O",
@@ -5370,6 +5572,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_GUARD_CALLABLE_LIST_APPEND_r33] = "_GUARD_CALLABLE_LIST_APPEND_r33",
     [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST",
     [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_r00] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_r00",
+    [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW",
+    [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW_r11] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW_r11",
     [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS",
     [_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r00] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r00",
     [_GUARD_CALLABLE_METHOD_DESCRIPTOR_NOARGS] = "_GUARD_CALLABLE_METHOD_DESCRIPTOR_NOARGS",
@@ -5911,6 +6115,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_LOCK_OBJECT_r11] = "_LOCK_OBJECT_r11",
     [_LOCK_OBJECT_r22] = "_LOCK_OBJECT_r22",
     [_LOCK_OBJECT_r33] = "_LOCK_OBJECT_r33",
+    [_LOOP_HEAD] = "_LOOP_HEAD",
+    [_LOOP_HEAD_r00] = "_LOOP_HEAD_r00",
     [_MAKE_CALLARGS_A_TUPLE] = "_MAKE_CALLARGS_A_TUPLE",
     [_MAKE_CALLARGS_A_TUPLE_r33] = "_MAKE_CALLARGS_A_TUPLE_r33",
     [_MAKE_CELL] = "_MAKE_CELL",
@@ -6410,8 +6616,22 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _BINARY_OP_TRUEDIV_FLOAT_INPLACE_RIGHT:
             return 2;
+        case _BINARY_OP_ADD_FLOAT_INT_INPLACE:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE:
+            return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE:
+            return 2;
+        case _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT:
+            return 2;
+        case _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT:
+            return 2;
+        case _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT:
+            return 2;
         case _BINARY_OP_ADD_UNICODE:
             return 2;
+        case _BINARY_OP_ADD_UNICODE_INPLACE:
+            return 2;
         case _BINARY_OP_INPLACE_ADD_UNICODE:
             return 2;
         case _GUARD_BINARY_OP_EXTEND_LHS:
@@ -6876,6 +7096,18 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _CALL_KW_NON_PY:
             return 3 + oparg;
+        case _GUARD_CALLABLE_BUILTIN_CLASS_KW:
+            return 0;
+        case _CALL_KW_BUILTIN_CLASS:
+            return 0;
+        case _GUARD_CALLABLE_BUILTIN_FAST_KW:
+            return 0;
+        case _CALL_KW_BUILTIN_FAST:
+            return 0;
+        case _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW:
+            return 0;
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST:
+            return 0;
         case _MAKE_CALLARGS_A_TUPLE:
             return 0;
         case _CHECK_IS_PY_CALLABLE_EX:
@@ -6946,6 +7178,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _JUMP_TO_TOP:
             return 0;
+        case _LOOP_HEAD:
+            return 0;
         case _SET_IP:
             return 0;
         case _CHECK_STACK_SPACE_OPERAND:
@@ -157,70 +157,73 @@ extern "C" {
 #define CALL_EX_PY                             152
 #define CALL_ISINSTANCE                        153
 #define CALL_KW_BOUND_METHOD                   154
-#define CALL_KW_NON_PY                         155
-#define CALL_KW_PY                             156
-#define CALL_LEN                               157
-#define CALL_LIST_APPEND                       158
-#define CALL_METHOD_DESCRIPTOR_FAST            159
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 160
-#define CALL_METHOD_DESCRIPTOR_NOARGS          161
-#define CALL_METHOD_DESCRIPTOR_O               162
-#define CALL_NON_PY_GENERAL                    163
-#define CALL_PY_EXACT_ARGS                     164
-#define CALL_PY_GENERAL                        165
-#define CALL_STR_1                             166
-#define CALL_TUPLE_1                           167
-#define CALL_TYPE_1                            168
-#define COMPARE_OP_FLOAT                       169
-#define COMPARE_OP_INT                         170
-#define COMPARE_OP_STR                         171
-#define CONTAINS_OP_DICT                       172
-#define CONTAINS_OP_SET                        173
-#define FOR_ITER_GEN                           174
-#define FOR_ITER_LIST                          175
-#define FOR_ITER_RANGE                         176
-#define FOR_ITER_TUPLE                         177
-#define FOR_ITER_VIRTUAL                       178
-#define GET_ITER_SELF                          179
-#define GET_ITER_VIRTUAL                       180
-#define JUMP_BACKWARD_JIT                      181
-#define JUMP_BACKWARD_NO_JIT                   182
-#define LOAD_ATTR_CLASS                        183
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   184
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      185
-#define LOAD_ATTR_INSTANCE_VALUE               186
-#define LOAD_ATTR_METHOD_LAZY_DICT             187
-#define LOAD_ATTR_METHOD_NO_DICT               188
-#define LOAD_ATTR_METHOD_WITH_VALUES           189
-#define LOAD_ATTR_MODULE                       190
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        191
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    192
-#define LOAD_ATTR_PROPERTY                     193
-#define LOAD_ATTR_SLOT                         194
-#define LOAD_ATTR_WITH_HINT                    195
-#define LOAD_GLOBAL_BUILTIN                    196
-#define LOAD_GLOBAL_MODULE                     197
-#define LOAD_SUPER_ATTR_ATTR                   198
-#define LOAD_SUPER_ATTR_METHOD                 199
-#define RESUME_CHECK                           200
-#define RESUME_CHECK_JIT                       201
-#define SEND_ASYNC_GEN                         202
-#define SEND_GEN                               203
-#define SEND_VIRTUAL                           204
-#define STORE_ATTR_INSTANCE_VALUE              205
-#define STORE_ATTR_SLOT                        206
-#define STORE_ATTR_WITH_HINT                   207
-#define STORE_SUBSCR_DICT                      208
-#define STORE_SUBSCR_LIST_INT                  209
-#define TO_BOOL_ALWAYS_TRUE                    210
-#define TO_BOOL_BOOL                           211
-#define TO_BOOL_INT                            212
-#define TO_BOOL_LIST                           213
-#define TO_BOOL_NONE                           214
-#define TO_BOOL_STR                            215
-#define UNPACK_SEQUENCE_LIST                   216
-#define UNPACK_SEQUENCE_TUPLE                  217
-#define UNPACK_SEQUENCE_TWO_TUPLE              218
+#define CALL_KW_BUILTIN_CLASS                  155
+#define CALL_KW_BUILTIN_FAST                   156
+#define CALL_KW_METHOD_DESCRIPTOR_FAST         157
+#define CALL_KW_NON_PY                         158
+#define CALL_KW_PY                             159
+#define CALL_LEN                               160
+#define CALL_LIST_APPEND                       161
+#define CALL_METHOD_DESCRIPTOR_FAST            162
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 163
+#define CALL_METHOD_DESCRIPTOR_NOARGS          164
+#define CALL_METHOD_DESCRIPTOR_O               165
+#define CALL_NON_PY_GENERAL                    166
+#define CALL_PY_EXACT_ARGS                     167
+#define CALL_PY_GENERAL                        168
+#define CALL_STR_1                             169
+#define CALL_TUPLE_1                           170
+#define CALL_TYPE_1                            171
+#define COMPARE_OP_FLOAT                       172
+#define COMPARE_OP_INT                         173
+#define COMPARE_OP_STR                         174
+#define CONTAINS_OP_DICT                       175
+#define CONTAINS_OP_SET                        176
+#define FOR_ITER_GEN                           177
+#define FOR_ITER_LIST                          178
+#define FOR_ITER_RANGE                         179
+#define FOR_ITER_TUPLE                         180
+#define FOR_ITER_VIRTUAL                       181
+#define GET_ITER_SELF                          182
+#define GET_ITER_VIRTUAL                       183
+#define JUMP_BACKWARD_JIT                      184
+#define JUMP_BACKWARD_NO_JIT                   185
+#define LOAD_ATTR_CLASS                        186
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   187
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      188
+#define LOAD_ATTR_INSTANCE_VALUE               189
+#define LOAD_ATTR_METHOD_LAZY_DICT             190
+#define LOAD_ATTR_METHOD_NO_DICT               191
+#define LOAD_ATTR_METHOD_WITH_VALUES           192
+#define LOAD_ATTR_MODULE                       193
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        194
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    195
+#define LOAD_ATTR_PROPERTY                     196
+#define LOAD_ATTR_SLOT                         197
+#define LOAD_ATTR_WITH_HINT                    198
+#define LOAD_GLOBAL_BUILTIN                    199
+#define LOAD_GLOBAL_MODULE                     200
+#define LOAD_SUPER_ATTR_ATTR                   201
+#define LOAD_SUPER_ATTR_METHOD                 202
+#define RESUME_CHECK                           203
+#define RESUME_CHECK_JIT                       204
+#define SEND_ASYNC_GEN                         205
+#define SEND_GEN                               206
+#define SEND_VIRTUAL                           207
+#define STORE_ATTR_INSTANCE_VALUE              208
+#define STORE_ATTR_SLOT                        209
+#define STORE_ATTR_WITH_HINT                   210
+#define STORE_SUBSCR_DICT                      211
+#define STORE_SUBSCR_LIST_INT                  212
+#define TO_BOOL_ALWAYS_TRUE                    213
+#define TO_BOOL_BOOL                           214
+#define TO_BOOL_INT                            215
+#define TO_BOOL_LIST                           216
+#define TO_BOOL_NONE                           217
+#define TO_BOOL_STR                            218
+#define UNPACK_SEQUENCE_LIST                   219
+#define UNPACK_SEQUENCE_TUPLE                  220
+#define UNPACK_SEQUENCE_TWO_TUPLE              221
 #define INSTRUMENTED_END_FOR                   233
 #define INSTRUMENTED_POP_ITER                  234
 #define INSTRUMENTED_END_SEND                  235
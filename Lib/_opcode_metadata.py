@@ -125,6 +125,9 @@ _specializations = frozendict(
             "CALL_KW_BOUND_METHOD",
             "CALL_KW_PY",
             "CALL_KW_NON_PY",
+            "CALL_KW_BUILTIN_CLASS",
+            "CALL_KW_BUILTIN_FAST",
+            "CALL_KW_METHOD_DESCRIPTOR_FAST",
     ),
     CALL_FUNCTION_EX=(
             "CALL_EX_PY",
@@ -160,70 +163,73 @@ _specialized_opmap = frozendict(
     CALL_EX_PY=152,
     CALL_ISINSTANCE=153,
     CALL_KW_BOUND_METHOD=154,
-    CALL_KW_NON_PY=155,
-    CALL_KW_PY=156,
-    CALL_LEN=157,
-    CALL_LIST_APPEND=158,
-    CALL_METHOD_DESCRIPTOR_FAST=159,
-    CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS=160,
-    CALL_METHOD_DESCRIPTOR_NOARGS=161,
-    CALL_METHOD_DESCRIPTOR_O=162,
-    CALL_NON_PY_GENERAL=163,
-    CALL_PY_EXACT_ARGS=164,
-    CALL_PY_GENERAL=165,
-    CALL_STR_1=166,
-    CALL_TUPLE_1=167,
-    CALL_TYPE_1=168,
-    COMPARE_OP_FLOAT=169,
-    COMPARE_OP_INT=170,
-    COMPARE_OP_STR=171,
-    CONTAINS_OP_DICT=172,
-    CONTAINS_OP_SET=173,
-    FOR_ITER_GEN=174,
-    FOR_ITER_LIST=175,
-    FOR_ITER_RANGE=176,
-    FOR_ITER_TUPLE=177,
-    FOR_ITER_VIRTUAL=178,
-    GET_ITER_SELF=179,
-    GET_ITER_VIRTUAL=180,
-    JUMP_BACKWARD_JIT=181,
-    JUMP_BACKWARD_NO_JIT=182,
-    LOAD_ATTR_CLASS=183,
-    LOAD_ATTR_CLASS_WITH_METACLASS_CHECK=184,
-    LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN=185,
-    LOAD_ATTR_INSTANCE_VALUE=186,
-    LOAD_ATTR_METHOD_LAZY_DICT=187,
-    LOAD_ATTR_METHOD_NO_DICT=188,
-    LOAD_ATTR_METHOD_WITH_VALUES=189,
-    LOAD_ATTR_MODULE=190,
-    LOAD_ATTR_NONDESCRIPTOR_NO_DICT=191,
-    LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES=192,
-    LOAD_ATTR_PROPERTY=193,
-    LOAD_ATTR_SLOT=194,
-    LOAD_ATTR_WITH_HINT=195,
-    LOAD_GLOBAL_BUILTIN=196,
-    LOAD_GLOBAL_MODULE=197,
-    LOAD_SUPER_ATTR_ATTR=198,
-    LOAD_SUPER_ATTR_METHOD=199,
-    RESUME_CHECK=200,
-    RESUME_CHECK_JIT=201,
-    SEND_ASYNC_GEN=202,
-    SEND_GEN=203,
-    SEND_VIRTUAL=204,
-    STORE_ATTR_INSTANCE_VALUE=205,
-    STORE_ATTR_SLOT=206,
-    STORE_ATTR_WITH_HINT=207,
-    STORE_SUBSCR_DICT=208,
-    STORE_SUBSCR_LIST_INT=209,
-    TO_BOOL_ALWAYS_TRUE=210,
-    TO_BOOL_BOOL=211,
-    TO_BOOL_INT=212,
-    TO_BOOL_LIST=213,
-    TO_BOOL_NONE=214,
-    TO_BOOL_STR=215,
-    UNPACK_SEQUENCE_LIST=216,
-    UNPACK_SEQUENCE_TUPLE=217,
-    UNPACK_SEQUENCE_TWO_TUPLE=218,
+    CALL_KW_BUILTIN_CLASS=155,
+    CALL_KW_BUILTIN_FAST=156,
+    CALL_KW_METHOD_DESCRIPTOR_FAST=157,
+    CALL_KW_NON_PY=158,
+    CALL_KW_PY=159,
+    CALL_LEN=160,
+    CALL_LIST_APPEND=161,
+    CALL_METHOD_DESCRIPTOR_FAST=162,
+    CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS=163,
+    CALL_METHOD_DESCRIPTOR_NOARGS=164,
+    CALL_METHOD_DESCRIPTOR_O=165,
+    CALL_NON_PY_GENERAL=166,
+    CALL_PY_EXACT_ARGS=167,
+    CALL_PY_GENERAL=168,
+    CALL_STR_1=169,
+    CALL_TUPLE_1=170,
+    CALL_TYPE_1=171,
+    COMPARE_OP_FLOAT=172,
+    COMPARE_OP_INT=173,
+    COMPARE_OP_STR=174,
+    CONTAINS_OP_DICT=175,
+    CONTAINS_OP_SET=176,
+    FOR_ITER_GEN=177,
+    FOR_ITER_LIST=178,
+    FOR_ITER_RANGE=179,
+    FOR_ITER_TUPLE=180,
+    FOR_ITER_VIRTUAL=181,
+    GET_ITER_SELF=182,
+    GET_ITER_VIRTUAL=183,
+    JUMP_BACKWARD_JIT=184,
+    JUMP_BACKWARD_NO_JIT=185,
+    LOAD_ATTR_CLASS=186,
+    LOAD_ATTR_CLASS_WITH_METACLASS_CHECK=187,
+    LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN=188,
+    LOAD_ATTR_INSTANCE_VALUE=189,
+    LOAD_ATTR_METHOD_LAZY_DICT=190,
+    LOAD_ATTR_METHOD_NO_DICT=191,
+    LOAD_ATTR_METHOD_WITH_VALUES=192,
+    LOAD_ATTR_MODULE=193,
+    LOAD_ATTR_NONDESCRIPTOR_NO_DICT=194,
+    LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES=195,
+    LOAD_ATTR_PROPERTY=196,
+    LOAD_ATTR_SLOT=197,
+    LOAD_ATTR_WITH_HINT=198,
+    LOAD_GLOBAL_BUILTIN=199,
+    LOAD_GLOBAL_MODULE=200,
+    LOAD_SUPER_ATTR_ATTR=201,
+    LOAD_SUPER_ATTR_METHOD=202,
+    RESUME_CHECK=203,
+    RESUME_CHECK_JIT=204,
+    SEND_ASYNC_GEN=205,
+    SEND_GEN=206,
+    SEND_VIRTUAL=207,
+    STORE_ATTR_INSTANCE_VALUE=208,
+    STORE_ATTR_SLOT=209,
+    STORE_ATTR_WITH_HINT=210,
+    STORE_SUBSCR_DICT=211,
+    STORE_SUBSCR_LIST_INT=212,
+    TO_BOOL_ALWAYS_TRUE=213,
+    TO_BOOL_BOOL=214,
+    TO_BOOL_INT=215,
+    TO_BOOL_LIST=216,
+    TO_BOOL_NONE=217,
+    TO_BOOL_STR=218,
+    UNPACK_SEQUENCE_LIST=219,
+    UNPACK_SEQUENCE_TUPLE=220,
+    UNPACK_SEQUENCE_TWO_TUPLE=221,
 )
 
 opmap = frozendict(
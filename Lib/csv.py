@@ -70,6 +70,7 @@ class excel:
                  QUOTE_MINIMAL, QUOTE_ALL, QUOTE_NONNUMERIC, QUOTE_NONE, \
                  QUOTE_STRINGS, QUOTE_NOTNULL
 from _csv import Dialect as _Dialect
+from _csv import _dict_template, _dict_from_template
 
 from io import StringIO
 
@@ -150,6 +151,8 @@ def __init__(self, f, fieldnames=None, restkey=None, restval=None,
         self.reader = reader(f, dialect, *args, **kwds)
         self.dialect = dialect
         self.line_num = 0
+        self._template = None
+        self._template_fieldnames = None
 
     def __iter__(self):
         return self
@@ -180,13 +183,20 @@ def __next__(self):
         # values
         while row == []:
             row = next(self.reader)
-        d = dict(zip(self.fieldnames, row))
-        lf = len(self.fieldnames)
+        fieldnames = self.fieldnames
+        lf = len(fieldnames)
         lr = len(row)
+        if lf == lr:
+            # All rows share the keys of a template dict built once.
+            if self._template_fieldnames is not fieldnames:
+                self._template = _dict_template(fieldnames)
+                self._template_fieldnames = fieldnames
+            return _dict_from_template(self._template, fieldnames, row)
+        d = dict(zip(fieldnames, row))
         if lf < lr:
             d[self.restkey] = row[lf:]
         elif lf > lr:
-            for key in self.fieldnames[lr:]:
+            for key in fieldnames[lr:]:
                 d[key] = self.restval
         return d
 
@@ -394,6 +394,24 @@ def check_pattern(rr):
         # Test that empty string always work:
         check_pattern(lambda *args: 0)
 
+    def test_find_short_needles(self):
+        # Short needles are searched for a block of positions at a time.
+        # Check matches at every position around the block boundaries, and
+        # needles whose first character repeats.
+        for needle in 'ab', 'aab', 'aba', 'abba', 'aaaab', 'a--a':
+            m = len(needle)
+            for n in range(m, 80):
+                for i in range(n - m + 1):
+                    text = '-' * i + needle + '-' * (n - m - i)
+                    self.checkequal(i, text, 'find', needle)
+                    self.checkequal(1, text, 'count', needle)
+                    self.checkequal(-1, text[:i + m - 1] + text[i + m:],
+                                    'find', needle)
+            text = ('-' + needle) * 40
+            self.checkequal(40, text, 'count', needle)
+            self.checkequal(3, text, 'count', needle, 0, 3 * (m + 1))
+            self.checkequal(['-'] * 40 + [''], text, 'split', needle)
+
     def test_find_many_lengths(self):
         haystack_repeats = [a * 10**e for e in range(6) for a in (1,2,5)]
         haystacks = [(n, self.fixtype("abcab"*n + "da")) for n in haystack_repeats]
@@ -1120,6 +1138,9 @@ def test_isascii(self):
             self.checkequal(False, ' '*p + '\x80', 'isascii')
             self.checkequal(True, ' '*p + '\x7f' + ' '*8, 'isascii')
             self.checkequal(False, ' '*p + '\x80' + ' '*8, 'isascii')
+        # ... and it checks several words per iteration for long inputs.
+        for p in range(80):
+            self.checkequal(False, ' '*p + '\x80' + ' '*(80 - p), 'isascii')
 
     def test_isdigit(self):
         self.checkequal(False, '', 'isdigit')
@@ -1624,6 +1624,33 @@ def __getitem__(self, index):
         self.assertEqual(max(data, key=f),
                          sorted(reversed(data), key=f)[-1])
 
+    def test_min_max_numbers(self):
+        # min() and max() compare floats and small ints without calling
+        # their rich comparison.
+        big = 2**100
+        self.assertEqual(max([3, -5, 2**62, -2**62]), 2**62)
+        self.assertEqual(min([3, -5, 2**62, -2**62]), -2**62)
+        self.assertEqual(max([3, big, -big]), big)
+        self.assertEqual(min([3, big, -big]), -big)
+        self.assertEqual(max([1.5, -2.5, 1e300]), 1e300)
+        self.assertEqual(min([1.5, -2.5, -1e300]), -1e300)
+        # The first of equal values is returned.
+        self.assertEqual(str(max(0.0, -0.0)), '0.0')
+        self.assertEqual(str(min(-0.0, 0.0)), '-0.0')
+        self.assertEqual(str(max(-0.0, 0.0)), '-0.0')
+        # Comparisons with NaN are false.
+        nan = float('nan')
+        self.assertTrue(math.isnan(max(nan, 1.0, 2.0)))
+        self.assertEqual(max(1.0, nan, 2.0), 2.0)
+        self.assertEqual(min(1.0, nan, 0.5), 0.5)
+        # Mixed types and subclasses still go through rich comparison.
+        self.assertEqual(max([1, 2.5, True]), 2.5)
+        self.assertIs(min([True, 1]), True)
+        class F(float):
+            def __gt__(self, other):
+                return True
+        self.assertEqual(type(max([1.0, F(0.5)])), F)
+
     def test_min(self):
         self.assertEqual(min('123123'), '1')
         self.assertEqual(min(1, 2, 3), 1)
@@ -64,6 +64,18 @@ def get_all_executors(func):
     return executors
 
 
+def get_loop_body_bounds(ops):
+    # A peeled loop jumps back to the start of its second iteration,
+    # rather than to just after _START_EXECUTOR.
+    for i, (opname, _, target, _) in enumerate(ops):
+        if opname == "_JUMP_TO_TOP":
+            loop_head = target & 0xFFFF
+            if loop_head > 1:
+                return loop_head, i
+            break
+    return None
+
+
 def iter_opnames(ex):
     for item in ex:
         yield item[0]
@@ -79,6 +91,24 @@ def iter_ops(ex):
 def get_ops(ex):
     return list(iter_ops(ex))
 
+def get_loop_body(ex):
+    ops = list(ex)
+    bounds = get_loop_body_bounds(ops)
+    if bounds is None:
+        return None
+    loop_head, loop_end = bounds
+    return [opname for opname, _, _, _ in ops[loop_head:loop_end]]
+
+def get_first_iteration(ex):
+    # The first iteration of a peeled loop is optimized the same way as a
+    # trace that does not loop.
+    ops = list(ex)
+    bounds = get_loop_body_bounds(ops)
+    if bounds is not None:
+        loop_head, loop_end = bounds
+        del ops[loop_head:loop_end]
+    return ops
+
 def count_ops(ex, name):
     return len([opname for opname in iter_opnames(ex) if opname == name])
 
@@ -165,6 +195,82 @@ def f(start, end, way):
         f(0, TIER2_THRESHOLD, 1)
         f(1, TIER2_THRESHOLD + 1, 1.0)
 
+    def test_memory_limit_evicts_cold_executors(self):
+        def f():
+            for _ in range(TIER2_THRESHOLD):
+                pass
+        def g():
+            for _ in range(TIER2_THRESHOLD):
+                pass
+        f()
+        exe = get_first_executor(f)
+        self.assertIsNotNone(exe)
+        stats = sys._jit.get_stats()
+        self.assertGreater(stats["memory"], 0)
+        self.addCleanup(sys._jit.set_memory_limit, stats["memory_limit"])
+        # Setting a limit that is exceeded requests a sweep: the first one
+        # marks f's executor as cold, and the second one evicts it, since
+        # it has not run in between.  Over the limit, g is not compiled.
+        for _ in range(2):
+            sys._jit.set_memory_limit(1)
+            g()
+        self.assertFalse(exe.is_valid())
+        self.assertIsNone(get_first_executor(f))
+        self.assertGreater(sys._jit.get_stats()["evicted"], stats["evicted"])
+        # Once there is room again, f is recompiled.
+        sys._jit.set_memory_limit(0)
+        for _ in range(3):
+            f()
+        self.assertIsNotNone(get_first_executor(f))
+        self.assertGreater(sys._jit.get_stats()["recompiled"],
+                           stats["recompiled"])
+
+    def test_memory_limit_keeps_warm_executors(self):
+        def f():
+            for _ in range(TIER2_THRESHOLD):
+                pass
+        ns = {}
+        exec(textwrap.dedent("".join(f"""
+            def g{n}():
+                for _ in range({TIER2_THRESHOLD}):
+                    pass
+            """ for n in range(10))), ns, ns)
+        f()
+        exe = get_first_executor(f)
+        self.assertIsNotNone(exe)
+        stats = sys._jit.get_stats()
+        self.addCleanup(sys._jit.set_memory_limit, stats["memory_limit"])
+        sys._jit.set_memory_limit(1)
+        # Refused trace attempts don't sweep on every attempt, so f's
+        # executor survives as long as it keeps running.
+        for _ in range(3):
+            f()
+            for n in range(10):
+                ns[f"g{n}"]()
+        self.assertTrue(exe.is_valid())
+        self.assertIsNone(get_first_executor(ns["g0"]))
+
+    def test_sampling(self):
+        def f():
+            x = 0
+            for i in range(TIER2_THRESHOLD * 2):
+                if i & 1:
+                    x += 1
+            return x
+        sys._jit.start_sampling()
+        self.addCleanup(sys._jit.stop_sampling)
+        for _ in range(3):
+            f()
+        samples = [s for s in sys._jit.get_samples() if s[1] is f.__code__]
+        kinds = {kind for kind, *_ in samples}
+        self.assertIn("compile", kinds)
+        self.assertIn("enter", kinds)
+        self.assertIn("exit", kinds)
+        for kind, code, offset, opname in samples:
+            self.assertNotIn(opname, ("ENTER_EXECUTOR", "JUMP_BACKWARD_JIT"))
+            if kind == "enter":
+                self.assertEqual(opname, "JUMP_BACKWARD")
+
 
 def get_bool_guard_ops():
     delta = id(True) ^ id(False)
@@ -1111,18 +1217,20 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * 26)
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(get_first_iteration(ex))]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        # Each call gets its own _CHECK_STACK_SPACE_OPERAND
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 2)
-        # Each _CHECK_STACK_SPACE_OPERAND has the framesize of its function
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy13.__code__)), uops_and_operands)
+        # Both calls share a single _CHECK_STACK_SPACE_OPERAND
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        # The calls don't overlap, so it checks for the largest framesize
+        largest_stack = max(
+            _testinternalcapi.get_co_framesize(dummy12.__code__),
+            _testinternalcapi.get_co_framesize(dummy13.__code__),
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
 
     def test_combine_stack_space_checks_nested(self):
         def dummy12(x):
@@ -1141,16 +1249,18 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * 7)
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(get_first_iteration(ex))]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 2)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy15.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        largest_stack = (
+            _testinternalcapi.get_co_framesize(dummy15.__code__) +
+            _testinternalcapi.get_co_framesize(dummy12.__code__)
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
 
     def test_combine_stack_space_checks_several_calls(self):
         def dummy12(x):
@@ -1174,18 +1284,19 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * 25)
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(get_first_iteration(ex))]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 4)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy13.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy18.__code__)), uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        largest_stack = (
+            _testinternalcapi.get_co_framesize(dummy18.__code__) +
+            max(_testinternalcapi.get_co_framesize(dummy12.__code__),
+                _testinternalcapi.get_co_framesize(dummy13.__code__))
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
 
     def test_combine_stack_space_checks_several_calls_different_order(self):
         # same as `several_calls` but with top-level calls reversed
@@ -1210,20 +1321,20 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * 25)
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(get_first_iteration(ex))]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 4)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy13.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy18.__code__)), uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        largest_stack = (
+            _testinternalcapi.get_co_framesize(dummy18.__code__) +
+            max(_testinternalcapi.get_co_framesize(dummy12.__code__),
+                _testinternalcapi.get_co_framesize(dummy13.__code__))
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
 
-    @unittest.skip("reopen when we combine multiple stack space checks into one")
     def test_combine_stack_space_complex(self):
         def dummy0(x):
             return x
@@ -1255,7 +1366,7 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * 3)
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(ex)]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 15)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 15)
@@ -1316,7 +1427,7 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * (repetitions + 9))
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(ex)]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
@@ -1356,7 +1467,7 @@ def testfunc(n):
         self.assertEqual(res, TIER2_THRESHOLD * 42)
         self.assertIsNotNone(ex)
 
-        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
+        uops_and_operands = [(opcode, operand) for opcode, _, _, operand in iter_ops(ex)]
         uop_names = [uop[0] for uop in uops_and_operands]
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 0)
@@ -1365,6 +1476,72 @@ def testfunc(n):
         largest_stack = _testinternalcapi.get_co_framesize(dummy15.__code__)
         self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack), uops_and_operands)
 
+    def test_loop_peeling_removes_invariant_guards(self):
+        def testfunc(n):
+            x = 0.0
+            for _ in range(n):
+                x = x + 1.0
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD * 1.0)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        body = get_loop_body(ex)
+        self.assertIsNotNone(body)
+        # The first iteration checks the iterator and the type of x...
+        self.assertIn("_ITER_CHECK_RANGE", uops)
+        self.assertIn("_GUARD_NOS_FLOAT", uops)
+        # ...so the loop body doesn't need to.
+        self.assertNotIn("_ITER_CHECK_RANGE", body)
+        self.assertNotIn("_GUARD_NOS_FLOAT", body)
+        self.assertIn("_BINARY_OP_ADD_FLOAT", body)
+
+    def test_loop_peeling_keeps_guards_on_mutable_types(self):
+        class A:
+            def __init__(self):
+                self.x = 1
+        class B:
+            @property
+            def x(self):
+                return 100
+
+        def testfunc(n, obj, classes):
+            total = 0
+            for i in range(n):
+                total += obj.x
+                obj.__class__ = classes[i >= n // 2]
+            return total
+
+        # The loop is traced while obj is a B, and then obj becomes an A
+        # without its local being stored to.
+        n = TIER2_THRESHOLD * 4
+        obj = A()
+        obj.__class__ = B
+        res = testfunc(n, obj, (B, A))
+        self.assertEqual(res, (n // 2 + 1) * 100 + (n // 2 - 1))
+        ex = get_first_executor(testfunc)
+        self.assertIsNotNone(ex)
+        body = get_loop_body(ex)
+        self.assertIsNotNone(body)
+        self.assertIn("_GUARD_TYPE_VERSION", body)
+
+    def test_spills_are_combined(self):
+        def testfunc(n):
+            for i in range(n):
+                t = (i, i, i, i, i, i)
+            return t
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, (TIER2_THRESHOLD - 1,) * 6)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        start = uops.index("_LOAD_FAST_BORROW_1")
+        end = uops.index("_BUILD_TUPLE")
+        # Only three values fit in registers, so pushing six values and then
+        # building a tuple from the stack needs at least two spills.
+        self.assertLessEqual(uops[start:end].count("_SPILL_OR_RELOAD"), 2)
+
     def test_many_nested(self):
         # overflow the trace_stack
         def dummy_a(x):
@@ -1613,7 +1790,7 @@ class Foo:
             attr = 1
 
         res, ex = self._run_with_optimizer(thing, Foo())
-        opnames = list(iter_opnames(ex))
+        opnames = list(iter_opnames(get_first_iteration(ex)))
         self.assertIsNotNone(ex)
         self.assertEqual(res, TIER2_THRESHOLD * 2)
         guard_type_version_count = opnames.count("_GUARD_TYPE_VERSION")
@@ -1639,7 +1816,7 @@ class Foo:
             attr = 1
 
         res, ex = self._run_with_optimizer(thing, Foo())
-        opnames = list(iter_opnames(ex))
+        opnames = list(iter_opnames(get_first_iteration(ex)))
         self.assertIsNotNone(ex)
         self.assertEqual(res, TIER2_THRESHOLD * 2)
         guard_type_version_count = opnames.count("_GUARD_TYPE_VERSION")
@@ -1715,7 +1892,7 @@ class Foo:
         res, ex = self._run_with_optimizer(thing, Foo())
         self.assertEqual(res, TIER2_THRESHOLD * 2)
         self.assertIsNotNone(ex)
-        self.assertEqual(list(iter_opnames(ex)).count("_GUARD_TYPE_VERSION"), 1)
+        self.assertEqual(list(iter_opnames(get_first_iteration(ex))).count("_GUARD_TYPE_VERSION"), 1)
         self.assertTrue(ex.is_valid())
         Foo.attr = 0
         self.assertFalse(ex.is_valid())
@@ -1738,7 +1915,7 @@ def thing(n):
 
         res, ex = self._run_with_optimizer(thing, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        opnames = list(iter_opnames(ex))
+        opnames = list(iter_opnames(get_first_iteration(ex)))
         guard_locked_count = opnames.count("_GUARD_TYPE_VERSION_LOCKED")
         # Only the first store needs the guard; the rest should be NOPed.
         self.assertEqual(guard_locked_count, 1)
@@ -1803,10 +1980,10 @@ def testfunc(n):
         _, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
         # The __init__ call should be traced through via _PUSH_FRAME
-        count = count_ops(ex, "_CREATE_INIT_FRAME")
+        count = count_ops(get_first_iteration(ex), "_CREATE_INIT_FRAME")
         self.assertEqual(count, 2)
         # __init__ resolution allows promotion of range to constant
-        count = count_ops(ex, "_CHECK_OBJECT")
+        count = count_ops(get_first_iteration(ex), "_CHECK_OBJECT")
         self.assertEqual(count, 1)
 
     def test_init_guards_removed_global(self):
@@ -1819,10 +1996,10 @@ def testfunc(n):
         _, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
         # The __init__ call should be traced through via _PUSH_FRAME
-        count = count_ops(ex, "_CREATE_INIT_FRAME")
+        count = count_ops(get_first_iteration(ex), "_CREATE_INIT_FRAME")
         self.assertEqual(count, 2)
         # __init__ resolution allows promotion of range to constant
-        count = count_ops(ex, "_CHECK_OBJECT")
+        count = count_ops(get_first_iteration(ex), "_CHECK_OBJECT")
         self.assertEqual(count, 0)
 
     def test_guard_type_version_locked_propagates(self):
@@ -1852,7 +2029,7 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD * (42 + 43))
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Both methods should be traced through
         self.assertEqual(uops.count("_PUSH_FRAME"), 2)
         # Type version propagation: one guard covers both method lookups
@@ -1882,7 +2059,7 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD * 3)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Both add() calls should be inlined
         push_count = uops.count("_PUSH_FRAME")
         self.assertEqual(push_count, 2)
@@ -2078,7 +2255,7 @@ def f(n):
         trace, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(trace, list("ABCDEFG") * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Only one guard remains:
         self.assertEqual(uops.count(self.guard_is_false), 1)
         self.assertEqual(uops.count(self.guard_is_true), 0)
@@ -2109,7 +2286,7 @@ def f(n):
         trace, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(trace, list("ABCDEFG") * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Only one guard remains:
         self.assertEqual(uops.count(self.guard_is_false), 0)
         self.assertEqual(uops.count(self.guard_is_true), 1)
@@ -2141,7 +2318,7 @@ def f(n):
         trace, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(trace, list("ABCDEFG") * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Only one guard remains:
         self.assertEqual(uops.count(self.guard_is_false), 1)
         self.assertEqual(uops.count(self.guard_is_true), 0)
@@ -2174,7 +2351,7 @@ def f(n):
         trace, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(trace, list("ABCDEFG") * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Only one guard remains:
         self.assertEqual(uops.count(self.guard_is_false), 1)
         self.assertEqual(uops.count(self.guard_is_true), 0)
@@ -2398,7 +2575,7 @@ def f(n):
         res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertEqual(uops.count("_GUARD_NOS_DICT_SUBSCRIPT"), 0)
         self.assertEqual(uops.count("_GUARD_NOS_DICT_STORE_SUBSCRIPT"), 0)
         self.assertEqual(uops.count("_BINARY_OP_SUBSCR_DICT_KNOWN_HASH"), 1)
@@ -2417,7 +2594,7 @@ def f(n):
         res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertEqual(uops.count("_BINARY_OP_SUBSCR_DICT_KNOWN_HASH"), 1)
         self.assertEqual(uops.count("_STORE_SUBSCR_DICT_KNOWN_HASH"), 1)
         self.assertEqual(uops.count("_GUARD_NOS_DICT_SUBSCRIPT"), 0)
@@ -2439,7 +2616,7 @@ def f(n):
         res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(res, 42 * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertEqual(uops.count("_BINARY_OP_SUBSCR_INIT_CALL"), 1)
 
     def test_remove_guard_for_known_type_list(self):
@@ -2457,7 +2634,7 @@ def f(n):
         res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(res, 2 * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertEqual(uops.count("_GUARD_NOS_LIST"), 0)
         self.assertEqual(uops.count("_STORE_SUBSCR_LIST_INT"), 1)
         self.assertEqual(uops.count("_GUARD_TOS_LIST"), 0)
@@ -2584,6 +2761,51 @@ def two_tuple(x):
         self.assertNotIn("_UNPACK_SEQUENCE_TUPLE", uops)
         self.assertNotIn("_UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE", uops)
 
+    def test_build_tuple_unpack_eliminated(self):
+        def f(n):
+            a, b, c, d, e = 1, 2, 3, 4, 5
+            for i in range(n):
+                a, b, c, d, e = b, c, d, e, a
+                w, x, y, z = e, a, d, b
+            return a, b, c, d, e, w, x, y, z
+
+        res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
+        k = TIER2_THRESHOLD % 5
+        t = (1, 2, 3, 4, 5)[k:] + (1, 2, 3, 4, 5)[:k]
+        self.assertEqual(res, t + (t[4], t[0], t[3], t[1]))
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BUILD_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_UNIQUE_TUPLE", uops)
+
+    def test_build_tuple_unpack_eliminated_mortal_items(self):
+        # The items are stored straight into the locals, so they must be
+        # new references even though the tuple that took them is gone.
+        deleted = []
+        class C:
+            def __init__(self, n):
+                self.n = n
+            def __del__(self):
+                deleted.append(self.n)
+
+        def f(n):
+            a, b, c, d, e = C(1), C(2), C(3), C(4), C(5)
+            for i in range(n):
+                a, b, c, d, e = b, c, d, e, a
+            self.assertEqual(deleted, [])
+            return a.n, b.n, c.n, d.n, e.n
+
+        # Run the executor for long enough to reuse freed memory.
+        res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD * 2)
+        k = TIER2_THRESHOLD * 2 % 5
+        self.assertEqual(res, (1, 2, 3, 4, 5)[k:] + (1, 2, 3, 4, 5)[:k])
+        self.assertEqual(sorted(deleted), [1, 2, 3, 4, 5])
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BUILD_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TUPLE", uops)
+
     def test_remove_guard_for_known_type_set(self):
         def f(n):
             x = 0
@@ -2630,9 +2852,9 @@ def f(n):
             return x
         res, ex = self._run_with_optimizer(f, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD * 2)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
-        count = count_ops(ex, "_GUARD_TOS_SLICE")
+        count = count_ops(get_first_iteration(ex), "_GUARD_TOS_SLICE")
         self.assertEqual(count, 1)
         self.assertIn("_BINARY_OP_SUBSCR_LIST_INT", uops)
 
@@ -2704,12 +2926,12 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertIn("_BINARY_OP_SUBSCR_STR_INT", uops)
         self.assertIn("_COMPARE_OP_STR", uops)
         self.assertIn("_POP_TOP_NOP", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP_INT"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP_INT"), 1)
 
     def test_binary_op_subscr_ustr_int(self):
         def testfunc(n):
@@ -2724,12 +2946,12 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertIn("_BINARY_OP_SUBSCR_USTR_INT", uops)
         self.assertIn("_COMPARE_OP_STR", uops)
         self.assertIn("_POP_TOP_NOP", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP_INT"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP_INT"), 1)
 
     def test_binary_op_subscr_dict(self):
         def testfunc(n):
@@ -3284,6 +3506,50 @@ def testfunc(n):
         self.assertIn("_CALL_BUILTIN_FAST_WITH_KEYWORDS", uops)
         self.assertNotIn("_GUARD_CALLABLE_BUILTIN_FAST_WITH_KEYWORDS", uops)
 
+    def test_call_kw_builtin_class(self):
+        def testfunc(n):
+            x = 0
+            for _ in range(n):
+                x += int("ff", base=16)
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD * 255)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_CALL_KW_BUILTIN_CLASS", uops)
+        self.assertNotIn("_GUARD_CALLABLE_BUILTIN_CLASS_KW", uops)
+
+    def test_call_kw_builtin_fast(self):
+        def testfunc(n):
+            x = 0
+            for _ in range(n):
+                y = sorted([3, 1, 2], reverse=True)
+                x += y[0]
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD * 3)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_CALL_KW_BUILTIN_FAST", uops)
+        self.assertNotIn("_GUARD_CALLABLE_BUILTIN_FAST_KW", uops)
+
+    def test_call_kw_method_descriptor_fast(self):
+        def testfunc(n):
+            x = 0
+            for _ in range(n):
+                y = "a,b,c".split(sep=",", maxsplit=1)
+                x += len(y)
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD * 2)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_CALL_KW_METHOD_DESCRIPTOR_FAST", uops)
+        self.assertNotIn("_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW", uops)
+
     def test_call_method_descriptor_o(self):
         def testfunc(n):
             x = 0
@@ -3301,7 +3567,7 @@ def testfunc(n):
         self.assertNotIn("_CALL_METHOD_DESCRIPTOR_O", uops)
         self.assertNotIn("_GUARD_CALLABLE_METHOD_DESCRIPTOR_O", uops)
         self.assertIn("_POP_TOP_NOP", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 4)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 4)
 
     def test_call_method_descriptor_noargs(self):
         def testfunc(n):
@@ -3382,11 +3648,11 @@ def testfunc(n):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, 0)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_CALL_INTRINSIC_1", uops)
-        self.assertEqual(count_ops(ex, "_POP_TOP_NOP"), 1)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_call_intrinsic_2(self):
         def testfunc(n):
@@ -3398,11 +3664,11 @@ def test_testfunc[T](n):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, 0)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_CALL_INTRINSIC_2", uops)
-        self.assertGreaterEqual(count_ops(ex, "_POP_TOP_NOP"), 2)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 4)
+        self.assertGreaterEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 4)
 
     def test_get_len_with_const_tuple(self):
         def testfunc(n):
@@ -4178,6 +4444,48 @@ def victim(a=0, b=nan, c=2):
                     uops,
                 )
 
+    def test_unicode_add_chain_inplace(self):
+        # a + b is a new string; appending c and d extends it in place
+        def testfunc(args):
+            a, b, c, d, n = args
+            for _ in range(n):
+                s = a + b + c + d
+            return s
+
+        res, ex = self._run_with_optimizer(testfunc, ("a", "b", "c", "d", TIER2_THRESHOLD))
+        self.assertEqual(res, "abcd")
+        self.assertIsNotNone(ex)
+        uops = get_opnames(get_first_iteration(ex))
+        self.assertEqual(uops.count("_BINARY_OP_ADD_UNICODE"), 1)
+        self.assertEqual(uops.count("_BINARY_OP_ADD_UNICODE_INPLACE"), 2)
+
+    def test_unicode_add_build_string_inplace(self):
+        def testfunc(args):
+            a, b, n = args
+            for i in range(n):
+                s = f"{a}{b}" + a
+            return s
+
+        res, ex = self._run_with_optimizer(testfunc, ("x", "y", TIER2_THRESHOLD))
+        self.assertEqual(res, "xyx")
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BUILD_STRING", uops)
+        self.assertIn("_BINARY_OP_ADD_UNICODE_INPLACE", uops)
+
+    def test_unicode_add_inplace_does_not_mutate_shared(self):
+        # "" + a returns a itself, which must not be extended in place
+        def testfunc(args):
+            a, b, n = args
+            for _ in range(n):
+                s = "" + a + b
+            return s, a
+
+        res, ex = self._run_with_optimizer(testfunc, ("abc" * 10, "d", TIER2_THRESHOLD))
+        self.assertEqual(res, ("abc" * 10 + "d", "abc" * 10))
+        self.assertIsNotNone(ex)
+        self.assertIn("_BINARY_OP_ADD_UNICODE_INPLACE", get_opnames(ex))
+
     def test_int_add_inplace_unique_lhs(self):
         # a * b produces a unique compact int; adding c reuses it in place
         def testfunc(args):
@@ -4339,10 +4647,10 @@ class C():
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_LOAD_ATTR_INSTANCE_VALUE", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
         self.assertIn("_POP_TOP_NOP", uops)
 
     def test_load_attr_module(self):
@@ -4358,9 +4666,9 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertIn(("_LOAD_ATTR_MODULE", "_POP_TOP_NOP"), itertools.pairwise(uops))
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_load_attr_with_hint(self):
         def testfunc(n):
@@ -4526,10 +4834,10 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, 3)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertIn("_BINARY_OP", uops)
         self.assertIn("_POP_TOP_NOP", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_binary_op_extend_float_long_add_refcount_elimination(self):
         def testfunc(n):
@@ -4599,6 +4907,57 @@ def testfunc(n):
         # propagates PyFloat_Type.
         self.assertNotIn("_GUARD_NOS_FLOAT", uops)
 
+    def test_binary_op_extend_float_int_inplace(self):
+        # x * y is a unique float, so `+ 1` and `- 2` (float op int) reuse it
+        def testfunc(n):
+            x = 3.5
+            y = 2.0
+            res = 0.0
+            for _ in range(n):
+                res = x * y + 1 - 2
+            return res
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, 6.0)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_ADD_FLOAT_INT_INPLACE", uops)
+        self.assertIn("_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE", uops)
+        self.assertNotIn("_BINARY_OP_EXTEND", uops)
+
+    def test_binary_op_extend_int_float_inplace_right(self):
+        # 3 * (x + y): int op unique float reuses the right operand
+        def testfunc(n):
+            x = 3.5
+            y = 2.0
+            res = 0.0
+            for _ in range(n):
+                res = 3 * (x + y)
+            return res
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, 16.5)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT", uops)
+        self.assertNotIn("_BINARY_OP_EXTEND", uops)
+
+    def test_binary_op_extend_float_int_no_inplace_non_unique(self):
+        # x + 1 where x is a local: x is not unique, no inplace
+        def testfunc(n):
+            x = 3.5
+            res = 0.0
+            for _ in range(n):
+                res = x + 1
+            return res
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, 4.5)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_EXTEND", uops)
+        self.assertNotIn("_BINARY_OP_ADD_FLOAT_INT_INPLACE", uops)
+
     def test_binary_op_extend_list_concat_type_propagation(self):
         # list + list is specialized via BINARY_OP_EXTEND. The tier 2 optimizer
         # should learn that the result is a list and eliminate subsequent
@@ -4658,7 +5017,7 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         # Both list additions use _BINARY_OP_EXTEND
         self.assertEqual(uops.count("_BINARY_OP_EXTEND"), 2)
         # But the second guard is eliminated because both operands
@@ -4683,7 +5042,7 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertIn("_BINARY_OP_EXTEND", uops)
         self.assertIn("_GUARD_BINARY_OP_EXTEND_RHS", uops)
         self.assertNotIn("_GUARD_BINARY_OP_EXTEND_LHS", uops)
@@ -4776,9 +5135,9 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, 10)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
         self.assertIn("_STORE_SUBSCR_LIST_INT", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 1)
         self.assertNotIn("_POP_TOP_INT", uops)
         self.assertIn("_POP_TOP_NOP", uops)
 
@@ -5244,11 +5603,11 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_BINARY_OP_SUBSCR_LIST_INT", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP_INT"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP_INT"), 1)
         self.assertIn("_POP_TOP_NOP", uops)
 
     def test_binary_subscr_tuple_int(self):
@@ -5263,11 +5622,11 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_BINARY_OP_SUBSCR_TUPLE_INT", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 3)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP_INT"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 3)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP_INT"), 1)
         self.assertIn("_POP_TOP_NOP", uops)
 
     def test_binary_subscr_frozendict_lowering(self):
@@ -5359,8 +5718,8 @@ def testfunc(n):
 
         self.assertIn("_BINARY_OP_SUBSCR_LIST_SLICE", uops)
         self.assertNotIn("_GUARD_TOS_LIST", uops)
-        self.assertEqual(count_ops(ex, "_POP_TOP"), 2)
-        self.assertEqual(count_ops(ex, "_POP_TOP_NOP"), 4)
+        self.assertEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
+        self.assertEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 4)
 
     def test_is_op(self):
         def test_is_false(n):
@@ -5642,11 +6001,11 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, -3)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_UNARY_NEGATIVE", uops)
         self.assertIn("_POP_TOP_NOP", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_unary_invert(self):
         def testfunc(n):
@@ -5658,11 +6017,11 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, -4)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_UNARY_INVERT", uops)
         self.assertIn("_POP_TOP_NOP", uops)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_make_function(self):
         def testfunc(n):
@@ -5674,7 +6033,7 @@ def testfunc(n):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_MAKE_FUNCTION", uops)
         self.assertEqual(uops.count("_POP_TOP_NOP"), 2)
@@ -5709,10 +6068,10 @@ class A:
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, TIER2_THRESHOLD)
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_MATCH_CLASS", uops)
-        self.assertEqual(count_ops(ex, "_POP_TOP_NOP"), 4)
+        self.assertEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 4)
 
     def test_dict_update(self):
         def testfunc(n):
@@ -5723,11 +6082,11 @@ def testfunc(n):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, {1: 2, 3: 4})
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_DICT_UPDATE", uops)
-        self.assertEqual(count_ops(ex, "_POP_TOP_NOP"), 1)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_set_update(self):
         def testfunc(n):
@@ -5738,11 +6097,11 @@ def testfunc(n):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, {1, 2, 3})
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_SET_UPDATE", uops)
-        self.assertEqual(count_ops(ex, "_POP_TOP_NOP"), 1)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_dict_merge(self):
         def testfunc(n):
@@ -5755,11 +6114,11 @@ def f(**kwargs):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, {"a": 1, "b": 2})
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_DICT_MERGE", uops)
-        self.assertGreaterEqual(count_ops(ex, "_POP_TOP_NOP"), 1)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertGreaterEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_list_extend(self):
         def testfunc(n):
@@ -5770,11 +6129,11 @@ def testfunc(n):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, [1, 2, 3])
-        uops = get_opnames(ex)
+        uops = get_opnames(get_first_iteration(ex))
 
         self.assertIn("_LIST_EXTEND", uops)
-        self.assertGreaterEqual(count_ops(ex, "_POP_TOP_NOP"), 1)
-        self.assertLessEqual(count_ops(ex, "_POP_TOP"), 2)
+        self.assertGreaterEqual(count_ops(get_first_iteration(ex), "_POP_TOP_NOP"), 1)
+        self.assertLessEqual(count_ops(get_first_iteration(ex), "_POP_TOP"), 2)
 
     def test_143026(self):
         # https://github.com/python/cpython/issues/143026
@@ -6149,9 +6508,9 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertEqual(res, 63 * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
-        self.assertNotIn("_LOAD_SUPER_ATTR_METHOD", uops)
-        self.assertEqual(uops.count("_GUARD_NOS_TYPE_VERSION"), 2)
+        self.assertNotIn("_LOAD_SUPER_ATTR_METHOD", get_opnames(ex))
+        self.assertEqual(count_ops(get_first_iteration(ex),
+                                   "_GUARD_NOS_TYPE_VERSION"), 2)
         self.assertTrue(ex.is_valid())
         # this should change the type version of A, which should invalidate the executor
         A.method1 = lambda self: 1
@@ -6160,9 +6519,9 @@ def testfunc(n):
         res, ex = self._run_with_optimizer(testfunc, 4 * TIER2_THRESHOLD)
         self.assertEqual(res, 4 * 22 * TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        uops = get_opnames(ex)
-        self.assertNotIn("_LOAD_SUPER_ATTR_METHOD", uops)
-        self.assertEqual(uops.count("_GUARD_NOS_TYPE_VERSION"), 2)
+        self.assertNotIn("_LOAD_SUPER_ATTR_METHOD", get_opnames(ex))
+        self.assertEqual(count_ops(get_first_iteration(ex),
+                                   "_GUARD_NOS_TYPE_VERSION"), 2)
 
     def test_settrace_then_polymorphic_call_does_not_crash(self):
         script_helper.assert_python_ok("-c", textwrap.dedent("""
@@ -1079,6 +1079,55 @@ def test_read_semi_sep(self):
         self.assertEqual(next(reader), {"1": '1', "2": '2', "3": 'abc',
                                          "4": '4', "5": '5', "6": '6'})
 
+    def test_read_many_rows(self):
+        # Rows with as many fields as fieldnames share their keys.
+        for n in (1, 5, 40):
+            fieldnames = [f"f{i}" for i in range(n)]
+            lines = [",".join(f"{j}.{i}" for i in range(n)) for j in range(3)]
+            rows = list(csv.DictReader(lines, fieldnames=fieldnames))
+            self.assertEqual(rows, [dict(zip(fieldnames, line.split(",")))
+                                    for line in lines])
+            rows[0]["new"] = "x"
+            del rows[1]["f0"]
+            self.assertEqual(rows[0], {**dict(zip(fieldnames,
+                                                  lines[0].split(","))),
+                                       "new": "x"})
+            self.assertNotIn("f0", rows[1])
+            self.assertEqual(rows[2], dict(zip(fieldnames,
+                                               lines[2].split(","))))
+
+    def test_read_duplicate_fieldnames(self):
+        reader = csv.DictReader(["a,b,a", "1,2,3", "4,5,6"])
+        self.assertEqual(list(reader), [{"a": '3', "b": '2'},
+                                        {"a": '6', "b": '5'}])
+
+    def test_read_changed_fieldnames(self):
+        reader = csv.DictReader(["a,b", "1,2", "3,4", "5,6", "7,8"])
+        self.assertEqual(next(reader), {"a": '1', "b": '2'})
+        reader.fieldnames[1] = "c"
+        self.assertEqual(next(reader), {"a": '3', "c": '4'})
+        reader.fieldnames = ["x", "y"]
+        self.assertEqual(next(reader), {"x": '5', "y": '6'})
+        reader.fieldnames.append("z")
+        self.assertEqual(next(reader), {"x": '7', "y": '8', "z": None})
+
+    @cpython_only
+    def test_dict_template_opaque(self):
+        _csv = import_helper.import_module("_csv")
+        class C:
+            pass
+        c = C()
+        c.a = c.b = 0
+        for template in (c.__dict__, {"a": 0, "b": 0}, None):
+            with self.assertRaises(TypeError):
+                _csv._dict_from_template(template, ["a", "b"], [1, 2])
+        reader = csv.DictReader(["a,b", "1,2", "3,4"])
+        self.assertEqual(next(reader), {"a": '1', "b": '2'})
+        self.assertNotIsInstance(reader._template, dict)
+        with self.assertRaises(TypeError):
+            reader._template["a"] = 0
+        self.assertEqual(next(reader), {"a": '3', "b": '4'})
+
 class TestArrayWrites(unittest.TestCase):
     def test_int_write(self):
         import array
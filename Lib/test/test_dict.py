@@ -1794,6 +1794,47 @@ def __hash__(self):
         self.assertEqual(dict_getitem_knownhash(d, k1, hash(k1)), 1)
         self.assertRaises(Exc, dict_getitem_knownhash, d, k2, hash(k2))
 
+    # Test _PyDict_FromTemplate()
+    @support.cpython_only
+    def test_from_template(self):
+        _testinternalcapi = import_helper.import_module('_testinternalcapi')
+        dict_from_template = _testinternalcapi.dict_from_template
+
+        class C:
+            pass
+
+        # An instance dict shares keys which still have room for more.
+        c = C()
+        c.a = c.b = 0
+        d = dict_from_template(c.__dict__, ('a', 'b'), (1, 2))
+        self.assertEqual(d, {'a': 1, 'b': 2})
+        c2 = C()
+        c2.a, c2.b, c2.c = 3, 4, 5
+        self.assertEqual(vars(c2), {'a': 3, 'b': 4, 'c': 5})
+        for i in range(40):
+            d[f'k{i}'] = i
+        self.assertEqual(len(d), 42)
+        self.assertEqual(d['a'], 1)
+
+        # The insertion order of a split dict differs from its keys order.
+        c = C()
+        c.a = c.b = 0
+        template = c.__dict__
+        template['a'] = template.pop('a')
+        self.assertEqual(list(template), ['b', 'a'])
+        d = dict_from_template(template, ('a', 'b'), (1, 2))
+        self.assertEqual(list(d.items()), [('a', 1), ('b', 2)])
+        d = dict_from_template(template, ('b', 'a'), (1, 2))
+        self.assertEqual(list(d.items()), [('b', 1), ('a', 2)])
+
+        # Keys which do not match the template.
+        d = dict_from_template({'x': 0}, ('y',), (1,))
+        self.assertEqual(d, {'y': 1})
+        d = dict_from_template({}, (), ())
+        self.assertEqual(d, {})
+        self.assertRaises(TypeError, dict_from_template, [], (), ())
+        self.assertRaises(ValueError, dict_from_template, {}, ('a',), ())
+
 
 from test import mapping_tests
 
@@ -11,6 +11,7 @@
 from test.support import threading_helper, gc_threshold
 
 import gc
+import os
 import sys
 import sysconfig
 import textwrap
@@ -899,6 +900,52 @@ def test_freeze(self):
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    @support.requires_fork()
+    @unittest.skipUnless(os.path.exists('/proc/self/smaps_rollup'),
+                         'requires /proc/self/smaps_rollup')
+    def test_freeze_immortalize(self):
+        # Objects made immortal before fork() are not written to when they
+        # are used in the child process, so their pages stay shared.
+        code = textwrap.dedent("""
+            import gc, os, sys
+
+            def private_kb():
+                with open('/proc/self/smaps_rollup') as f:
+                    return sum(int(line.split()[1]) for line in f
+                               if line.startswith(('Private_Clean:',
+                                                   'Private_Dirty:')))
+
+            def child_private_kb(data):
+                r, w = os.pipe()
+                pid = os.fork()
+                if pid == 0:
+                    before = private_kb()
+                    for key, value in data.items():
+                        for item in value:
+                            pass
+                    os.write(w, str(private_kb() - before).encode())
+                    os._exit(0)
+                os.waitpid(pid, 0)
+                return int(os.read(r, 100))
+
+            data = {f'key{i}': [float(i), f'value{i}', (i, -i)]
+                    for i in range(100_000)}
+            gc.collect()
+            gc.freeze()
+            mortal = child_private_kb(data)
+
+            gc.freeze(immortalize=True)
+            for key, value in data.items():
+                for obj in (key, value, *value, *value[2]):
+                    assert sys._is_immortal(obj), obj
+            immortal = child_private_kb(data)
+            print(mortal, immortal)
+        """)
+        rc, out, err = assert_python_ok('-c', code)
+        mortal, immortal = map(int, out.split())
+        self.assertGreater(mortal, 4096)
+        self.assertLess(immortal, mortal // 4)
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -1288,6 +1335,39 @@ def test_tuple_untrack_counts(self):
         # Use n // 2 just in case some other objects were collected.
         self.assertTrue(new_count - count > (n // 2))
 
+    @unittest.skipUnless(Py_GIL_DISABLED, "requires free-threaded GC")
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    def test_parallel_mark_alive(self):
+        # Mark reachable objects with several threads.
+        old = _testinternalcapi.set_gc_mark_alive_workers(4)
+        self.addCleanup(_testinternalcapi.set_gc_mark_alive_workers, old)
+
+        class A:
+            pass
+        # Long lists fill and share several work packets, the chain is
+        # marked one object at a time.
+        live = [[A() for _ in range(20)] for _ in range(2000)]
+        chain = None
+        for i in range(5000):
+            chain = [chain, (i, A())]
+        for _ in range(3):
+            garbage = [A() for _ in range(1000)]
+            for a, b in zip(garbage, garbage[1:]):
+                a.next = b
+            garbage[-1].next = garbage[0]
+            wr = weakref.ref(garbage[500])
+            del garbage, a, b
+            self.assertGreaterEqual(gc.collect(), 1000)
+            self.assertIsNone(wr())
+        self.assertEqual([len(x) for x in live], [20] * 2000)
+        self.assertTrue(all(type(a) is A for x in live for a in x))
+        n = 0
+        while chain is not None:
+            self.assertIs(type(chain[1][1]), A)
+            chain = chain[0]
+            n += 1
+        self.assertEqual(n, 5000)
+
     @requires_gil_enabled('need generational GC')
     @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
     def test_heap_size(self):
@@ -107,6 +107,29 @@ def test_keys_reuse(self):
         self.check_keys_reuse(s, decoder.decode)
         self.assertFalse(decoder.memo)
 
+    def test_repeated_objects(self):
+        s = ('[{"a": 1, "b": [2]}, {"a": 3, "b": {"a": 4, "b": 5}},'
+             ' {"a": 6, "b": 7}, {"b": 8, "a": 9}, {"a": 10},'
+             ' {"a": 11, "a": 12, "b": 13}, {"a": 14, "a": 15, "b": 16}]')
+        expected = [{"a": 1, "b": [2]}, {"a": 3, "b": {"a": 4, "b": 5}},
+                    {"a": 6, "b": 7}, {"b": 8, "a": 9}, {"a": 10},
+                    {"a": 12, "b": 13}, {"a": 15, "b": 16}]
+        rval = self.loads(s)
+        self.assertEqual(rval, expected)
+        self.assertEqual([list(d) for d in rval],
+                         [list(d) for d in expected])
+        rval[2]["c"] = 0
+        del rval[1]["a"]
+        self.assertEqual(rval[2], {"a": 6, "b": 7, "c": 0})
+        self.assertEqual(rval[1], {"b": {"a": 4, "b": 5}})
+        self.assertEqual(rval[0], {"a": 1, "b": [2]})
+        self.assertEqual(self.loads(s, object_hook=len),
+                         [2, 2, 2, 2, 1, 2, 2])
+
+        # Objects with many keys.
+        d = {f"key{i}": i for i in range(40)}
+        self.assertEqual(self.loads(self.dumps([d, d, d])), [d, d, d])
+
     def test_extra_data(self):
         s = '[1, 2, 3]5'
         msg = 'Extra data'
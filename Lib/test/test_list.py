@@ -284,6 +284,27 @@ def test_preallocation(self):
         self.assertEqual(iter_size, sys.getsizeof(list([0] * 10)))
         self.assertEqual(iter_size, sys.getsizeof(list(range(10))))
 
+    def test_count_index_contains_numbers(self):
+        # Floats and small ints are compared without calling __eq__.
+        nan = float('nan')
+        lst = [1, -2, 2**62, 2**100, 1.5, -0.0, nan]
+        self.assertIn(-2, lst)
+        self.assertIn(2**62, lst)
+        self.assertIn(2**100, lst)
+        self.assertIn(1.0, lst)
+        self.assertIn(0.0, lst)
+        self.assertIn(nan, lst)
+        self.assertNotIn(float('nan'), lst)
+        self.assertNotIn(2**62 + 1, lst)
+        self.assertNotIn(1.25, lst)
+        self.assertEqual(lst.index(0), 5)
+        self.assertEqual(lst.index(1.5), 4)
+        self.assertEqual(lst.index(nan), 6)
+        self.assertRaises(ValueError, lst.index, -1)
+        self.assertEqual([1, 1.0, True, 2, 1].count(1), 4)
+        self.assertEqual([0.5, 0.5, nan, 0.25].count(0.5), 2)
+        self.assertEqual([nan, nan].count(float('nan')), 0)
+
     def test_count_index_remove_crashes(self):
         # bpo-38610: The count(), index(), and remove() methods were not
         # holding strong references to list elements while calling
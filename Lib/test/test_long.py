@@ -12,6 +12,7 @@
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+TOOM3_CUTOFF = 200      # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +230,36 @@ def test_karatsuba(self):
                          1)
                     self.assertEqual(x, y)
 
+    def test_toom3(self):
+        def slow_mul(a, b):
+            # Multiply by slices of b that are too short for Karatsuba.
+            width = (KARATSUBA_CUTOFF - 1) * SHIFT
+            result = 0
+            shift = 0
+            babs = abs(b)
+            while babs:
+                result += (abs(a) * (babs & ((1 << width) - 1))) << shift
+                babs >>= width
+                shift += width
+            return -result if (a < 0) != (b < 0) else result
+
+        rng = random.Random(3)
+        digits = list(range(TOOM3_CUTOFF - 2, TOOM3_CUTOFF + 6))
+        digits.extend([TOOM3_CUTOFF * 3 + 1, TOOM3_CUTOFF * 10])
+        for adigits in digits:
+            for bdigits in (adigits, adigits + 1, adigits * 4 // 3):
+                with self.subTest(adigits=adigits, bdigits=bdigits):
+                    a = rng.getrandbits(adigits * SHIFT)
+                    b = rng.getrandbits(bdigits * SHIFT)
+                    self.assertEqual(a * b, slow_mul(a, b))
+                    self.assertEqual(-a * b, slow_mul(-a, b))
+                    self.assertEqual(a * a, slow_mul(a, a))
+                    # All digits equal to MASK maximize the carries.
+                    a = (1 << (adigits * SHIFT)) - 1
+                    b = (1 << (bdigits * SHIFT)) - 1
+                    self.assertEqual(a * b, slow_mul(a, b))
+                    self.assertEqual(b * b, slow_mul(b, b))
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -2171,6 +2171,41 @@ class MyList(list): pass
         self.assert_no_opcode(my_list_append, "CALL_LIST_APPEND")
         self.assert_no_opcode(my_list_append, "CALL")
 
+    @cpython_only
+    @requires_specialization
+    def test_call_kw_c_functions(self):
+        r = range(_testinternalcapi.SPECIALIZATION_THRESHOLD)
+
+        def call_kw_builtin_fast():
+            for _ in r:
+                sorted([2, 1], reverse=True)
+
+        call_kw_builtin_fast()
+        self.assert_specialized(call_kw_builtin_fast, "CALL_KW_BUILTIN_FAST")
+        self.assert_no_opcode(call_kw_builtin_fast, "CALL_KW_NON_PY")
+
+        def call_kw_method_descriptor(s):
+            for _ in r:
+                s.split(sep=",", maxsplit=1)
+
+        call_kw_method_descriptor("a,b,c")
+        self.assert_specialized(call_kw_method_descriptor,
+                                "CALL_KW_METHOD_DESCRIPTOR_FAST")
+        self.assert_no_opcode(call_kw_method_descriptor, "CALL_KW_NON_PY")
+
+        def call_kw_builtin_class():
+            for _ in r:
+                int("ff", base=16)
+
+        call_kw_builtin_class()
+        self.assert_specialized(call_kw_builtin_class, "CALL_KW_BUILTIN_CLASS")
+        self.assert_no_opcode(call_kw_builtin_class, "CALL_KW_NON_PY")
+
+        # The descriptor guard checks the type of self
+        class S(str):
+            pass
+        call_kw_method_descriptor(S("a,b"))
+
     @cpython_only
     @requires_specialization
     def test_load_attr_module_with_getattr(self):
@@ -383,6 +383,37 @@ def test_unsafe_float_compare(self):
         check_against_PyObject_RichCompareBool(self, [float(x) for
                                                       x in range(100)])
 
+    def test_radix_sort(self):
+        # Large lists of compact ints or of floats are radix sorted.
+        def check(L):
+            for reverse in False, True:
+                # Tuple keys are never radix sorted.
+                expected = sorted(range(len(L)), key=lambda i: (L[i],),
+                                  reverse=reverse)
+                for opt, ref in zip(sorted(L, reverse=reverse), expected):
+                    self.assertIs(opt, L[ref])
+                # Sorting with a key function moves the values along.
+                pairs = sorted(enumerate(L), key=lambda p: p[1],
+                               reverse=reverse)
+                self.assertEqual([i for i, x in pairs], expected)
+
+        random.seed(0)
+        n = 5000
+        check([random.randrange(-2**29, 2**29) for _ in range(n)])
+        check([random.randrange(-3, 3) for _ in range(n)])
+        check([random.random() - 0.5 for _ in range(n)])
+        # Distinct objects that compare equal keep their order.
+        check([random.choice([0.0, -0.0, 2.0, -2.0, 1e-310, -1e-310,
+                              1e308, float('inf'), float('-inf')])
+               for _ in range(n)])
+        check([float(random.randrange(10)) for _ in range(n)])
+
+        # NaNs and presorted data are left to timsort.
+        L = [random.random() for _ in range(n)] + [float('nan')]
+        check_against_PyObject_RichCompareBool(self, L)
+        L = list(range(n)) + [random.randrange(n) for _ in range(10)]
+        self.assertEqual(sorted(L), sorted(L, key=lambda x: (x,)))
+
     def test_unsafe_tuple_compare(self):
         # This test was suggested by Tim Peters. It verifies that the tuple
         # comparison respects the current tuple compare semantics, which do not
@@ -1901,6 +1901,41 @@ def test_utf8_decode_valid_sequences(self):
             self.assertEqual(seq.decode('utf-8'), res)
 
 
+    def test_decode_ascii_prefix(self):
+        # The ASCII fast paths of the decoders check several bytes at once.
+        # Check that a non-ASCII character is found at any position and
+        # with any alignment.
+        data = bytes(range(32, 128)) * 2
+        for start in range(8):
+            for i in range(start, len(data)):
+                s = data[start:i] + b'\xc3\xa9' + data[i:]
+                self.assertEqual(s.decode('utf-8'),
+                                 data[start:i].decode() + '\xe9' +
+                                 data[i:].decode())
+                s = data[start:i] + b'\xe9' + data[i:]
+                self.assertRaises(UnicodeDecodeError, s.decode, 'ascii')
+                self.assertEqual(s.decode('latin-1'),
+                                 data[start:i].decode() + '\xe9' +
+                                 data[i:].decode())
+
+    def test_utf8_ascii_runs(self):
+        # The UTF-8 codec and the computation of the maximum character also
+        # check several characters at once for UCS2 and UCS4 strings.
+        data = ''.join(map(chr, range(32, 128))) * 2
+        for wide in '\u20ac', '\U0001f600':
+            for c in '\xe9', '\u0100', '\U00010000':
+                for start in range(8):
+                    for i in range(start, len(data), 3):
+                        s = wide + data[start:i] + c + data[i:]
+                        encoded = s.encode('utf-8')
+                        self.assertEqual(encoded,
+                                         wide.encode() + data[start:i].encode()
+                                         + c.encode() + data[i:].encode())
+                        self.assertEqual(encoded.decode('utf-8'), s)
+                        # Slicing computes the maximum character
+                        self.assertEqual(s[1:], data[start:i] + c + data[i:])
+                        self.assertEqual(s[1:i - start + 1], data[start:i])
+
     def test_utf8_decode_invalid_sequences(self):
         # continuation bytes in a sequence of 2, 3, or 4 bytes
         continuation_bytes = [bytes([x]) for x in range(0x80, 0xC0)]
@@ -27,6 +27,7 @@
 except ImportError:
     interpreters = None
 import textwrap
+import types
 import unittest
 import warnings
 
@@ -1125,12 +1126,44 @@ def test_debugmallocstats(self):
         if sys.platform != "win32":
             with_pymalloc = sysconfig.get_config_var("WITH_PYMALLOC")
             self.assertIn(b"free PyDictObjects", err)
+            self.assertIn(b"free PyMethodObjects", err)
+            self.assertIn(b"free PyBytesWriters", err)
             if with_pymalloc:
                 self.assertIn(b'Small block threshold', err)
 
         # The function has no parameter
         self.assertRaises(TypeError, sys._debugmallocstats, True)
 
+    @test.support.cpython_only
+    def test_release_memory(self):
+        try:
+            import _testinternalcapi
+            alloc_name = _testinternalcapi.pymem_getallocatorsname()
+        except (ImportError, RuntimeError):
+            alloc_name = None
+
+        # Free most objects, but keep some alive in every arena.
+        data = [(i, str(i)) for i in range(300_000)]
+        keep = data[::5000]
+        del data
+        gc.collect()
+        released = sys._release_memory()
+        self.assertIs(type(released), int)
+        # pymalloc can only release pages smaller than its pools: 16 KiB
+        # on 64-bit platforms and 4 KiB otherwise.
+        pool_size = 16 * 1024 if sys.maxsize > 2**32 else 4 * 1024
+        if (alloc_name in ('mimalloc', 'mimalloc_debug')
+                or (alloc_name in ('pymalloc', 'pymalloc_debug')
+                    and os.name == 'posix'
+                    and support.get_pagesize() < pool_size)):
+            self.assertGreater(released, 0)
+        else:
+            self.assertGreaterEqual(released, 0)
+        self.assertEqual(len(keep), 60)
+
+        # The function has no parameter
+        self.assertRaises(TypeError, sys._release_memory, True)
+
     @unittest.skipUnless(hasattr(sys, "getallocatedblocks"),
                          "sys.getallocatedblocks unavailable on this build")
     def test_getallocatedblocks(self):
@@ -2288,6 +2321,55 @@ def frame_4_interpreter() -> None:
         assert_python_ok("-c", script.format(enabled=False), PYTHON_JIT="0")
         assert_python_ok("-c", script.format(enabled=available), PYTHON_JIT="1")
 
+    def test_jit_memory_limit(self):
+        script = textwrap.dedent(
+            """
+            import sys
+            stats = sys._jit.get_stats()
+            assert stats["memory_limit"] == {limit}, stats
+            keys = ("executors", "memory", "created", "evicted", "recompiled")
+            for key in keys:
+                assert stats[key] >= 0, stats
+            # The JIT may already have compiled code during startup
+            assert stats["created"] >= stats["executors"], stats
+            sys._jit.set_memory_limit(12345)
+            new_stats = sys._jit.get_stats()
+            assert new_stats["memory_limit"] == 12345, new_stats
+            for key in ("created", "evicted", "recompiled"):
+                assert new_stats[key] >= stats[key], (stats, new_stats)
+            try:
+                sys._jit.set_memory_limit(-1)
+            except ValueError:
+                pass
+            else:
+                raise AssertionError("negative limit accepted")
+            """
+        )
+        assert_python_ok("-c", script.format(limit=0))
+        assert_python_ok("-c", script.format(limit=1 << 20),
+                         PYTHON_JIT_MEMORY_LIMIT=str(1 << 20))
+        assert_python_ok("-c", script.format(limit=0),
+                         PYTHON_JIT_MEMORY_LIMIT="-1")
+
+    def test_jit_sampling(self):
+        self.assertEqual(sys._jit.get_samples(), [])
+        for args in [(0,), (-1,), (10, 0)]:
+            with self.assertRaises(ValueError):
+                sys._jit.start_sampling(*args)
+        sys._jit.start_sampling(16, 2)
+        try:
+            samples = sys._jit.get_samples()
+            self.assertIsInstance(samples, list)
+            self.assertLessEqual(len(samples), 16)
+            for kind, code, offset, opname in samples:
+                self.assertIn(kind, ("enter", "exit", "compile", "abort"))
+                self.assertIsInstance(code, types.CodeType)
+                self.assertIsInstance(offset, int)
+                self.assertIsInstance(opname, str)
+        finally:
+            sys._jit.stop_sampling()
+        self.assertEqual(sys._jit.get_samples(), [])
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -14,6 +14,7 @@ module instead.
 #endif
 
 #include "Python.h"
+#include "pycore_dict.h"          // _PyDict_FromTemplate()
 #include "pycore_pyatomic_ft_wrappers.h"
 
 #include <stddef.h>               // offsetof()
@@ -1712,6 +1713,107 @@ _csv_field_size_limit_impl(PyObject *module, PyObject *new_limit)
     return PyLong_FromSsize_t(old_limit);
 }
 
+#define DICT_TEMPLATE_CAPSULE_NAME "_csv._dict_template"
+
+static void
+dict_template_destructor(PyObject *capsule)
+{
+    PyObject *template = PyCapsule_GetPointer(capsule,
+                                              DICT_TEMPLATE_CAPSULE_NAME);
+    Py_XDECREF(template);
+}
+
+/*[clinic input]
+_csv._dict_template
+
+    keys: object
+    /
+
+Return an opaque template for building dicts with the given keys.
+
+For use by csv.DictReader with _dict_from_template().
+[clinic start generated code]*/
+
+static PyObject *
+_csv__dict_template(PyObject *module, PyObject *keys)
+/*[clinic end generated code: output=f9474d6df0dac3e8 input=42b53b5a8f7ea497]*/
+{
+    PyObject *seq = PySequence_Tuple(keys);
+    if (seq == NULL) {
+        return NULL;
+    }
+    PyObject *template = _PyDict_NewTemplate(PySequence_Fast_ITEMS(seq),
+                                             PyTuple_GET_SIZE(seq));
+    Py_DECREF(seq);
+    if (template == NULL) {
+        return NULL;
+    }
+    /* Hide the dict, so that its keys and their order cannot be changed
+       behind the back of _dict_from_template(). */
+    PyObject *res = PyCapsule_New(template, DICT_TEMPLATE_CAPSULE_NAME,
+                                  dict_template_destructor);
+    if (res == NULL) {
+        Py_DECREF(template);
+    }
+    return res;
+}
+
+/*[clinic input]
+_csv._dict_from_template
+
+    template as capsule: object
+    keys: object
+    values: object
+    /
+
+Return dict(zip(keys, values)), where keys and values have the same length.
+
+This is faster if keys are the keys of template, as returned by
+_dict_template().
+[clinic start generated code]*/
+
+static PyObject *
+_csv__dict_from_template_impl(PyObject *module, PyObject *capsule,
+                              PyObject *keys, PyObject *values)
+/*[clinic end generated code: output=2affd7f8c4db59ae input=4e5e95bef4a23c01]*/
+{
+    if (!PyCapsule_IsValid(capsule, DICT_TEMPLATE_CAPSULE_NAME)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "template must be returned by _dict_template()");
+        return NULL;
+    }
+    PyObject *template = PyCapsule_GetPointer(capsule,
+                                              DICT_TEMPLATE_CAPSULE_NAME);
+    assert(template != NULL && PyDict_CheckExact(template));
+    PyObject *keys_seq = PySequence_Fast(keys, "keys must be a sequence");
+    if (keys_seq == NULL) {
+        return NULL;
+    }
+    PyObject *values_seq = PySequence_Fast(values,
+                                           "values must be a sequence");
+    if (values_seq == NULL) {
+        Py_DECREF(keys_seq);
+        return NULL;
+    }
+    PyObject *res;
+    Py_BEGIN_CRITICAL_SECTION2(keys_seq, values_seq);
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(keys_seq);
+    if (PySequence_Fast_GET_SIZE(values_seq) != n) {
+        PyErr_SetString(PyExc_ValueError,
+                        "keys and values must have the same length");
+        res = NULL;
+    }
+    else {
+        res = _PyDict_FromTemplate(template,
+                                   PySequence_Fast_ITEMS(keys_seq),
+                                   PySequence_Fast_ITEMS(values_seq), n);
+    }
+    Py_END_CRITICAL_SECTION2();
+    Py_DECREF(keys_seq);
+    Py_DECREF(values_seq);
+    return res;
+}
+
 static PyType_Slot error_slots[] = {
     {0, NULL},
 };
@@ -1773,6 +1875,8 @@ static struct PyMethodDef csv_methods[] = {
     _CSV_UNREGISTER_DIALECT_METHODDEF
     _CSV_GET_DIALECT_METHODDEF
     _CSV_FIELD_SIZE_LIMIT_METHODDEF
+    _CSV__DICT_TEMPLATE_METHODDEF
+    _CSV__DICT_FROM_TEMPLATE_METHODDEF
     { NULL, NULL }
 };
 
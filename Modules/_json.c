@@ -11,6 +11,7 @@
 #include "Python.h"
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCall()
 #include "pycore_critical_section.h" // Py_BEGIN_CRITICAL_SECTION_SEQUENCE_FAST()
+#include "pycore_dict.h"           // _PyDict_FromTemplate()
 #include "pycore_global_strings.h" // _Py_ID()
 #include "pycore_pyerrors.h"      // _PyErr_FormatNote
 #include "pycore_runtime.h"       // _PyRuntime
@@ -86,7 +87,7 @@ static PyObject *
 py_encode_basestring_ascii(PyObject* Py_UNUSED(self), PyObject *pystr);
 
 static PyObject *
-scan_once_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr);
+scan_once_unicode(PyScannerObject *s, PyObject *memo, PyObject *templates, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr);
 static PyObject *
 _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx);
 static PyObject *
@@ -739,8 +740,53 @@ scanner_clear(PyObject *op)
     return 0;
 }
 
+/* Objects with at most this many items are collected in arrays, and then
+   built with _build_object(). */
+#define OBJECT_ITEMS_MAX 16
+/* Maximal number of first keys recorded by _build_object() in a call. */
+#define OBJECT_TEMPLATES_MAX 256
+
+static PyObject *
+_build_object(PyObject *templates, PyObject *const *keys,
+              PyObject *const *values, Py_ssize_t n)
+{
+    /* Build a dict from the n (memoized) keys and values of an object.
+       Objects with the same keys, such as the records of a list, are built
+       from a template dict, which is recorded in templates under the first
+       key the second time that key starts an object. */
+    if (n == 0) {
+        return PyDict_New();
+    }
+    PyObject *template;
+    int rc = PyDict_GetItemRef(templates, keys[0], &template);
+    if (rc < 0) {
+        return NULL;
+    }
+    if (rc == 0) {
+        if (PyDict_GET_SIZE(templates) < OBJECT_TEMPLATES_MAX &&
+            PyDict_SetItem(templates, keys[0], Py_None) < 0)
+        {
+            return NULL;
+        }
+        return _PyDict_FromItems(keys, 1, values, 1, n);
+    }
+    if (Py_IsNone(template)) {
+        template = _PyDict_NewTemplate(keys, n);
+        if (template == NULL) {
+            return NULL;
+        }
+        if (PyDict_SetItem(templates, keys[0], template) < 0) {
+            Py_DECREF(template);
+            return NULL;
+        }
+    }
+    PyObject *rval = _PyDict_FromTemplate(template, keys, values, n);
+    Py_DECREF(template);
+    return rval;
+}
+
 static PyObject *
-_parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
+_parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *templates, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
 {
     /* Read a JSON object from PyUnicode pystr.
     idx is the index of the first character after the opening curly brace.
@@ -758,17 +804,21 @@ _parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ss
     int has_pairs_hook = (s->object_pairs_hook != Py_None);
     Py_ssize_t next_idx;
     Py_ssize_t comma_idx;
+    /* Without object_pairs_hook, the first items are collected here, and
+       the dict is only created when there are too many of them. */
+    PyObject *keys[OBJECT_ITEMS_MAX];
+    PyObject *values[OBJECT_ITEMS_MAX];
+    Py_ssize_t nitems = 0;
 
     str = PyUnicode_DATA(pystr);
     kind = PyUnicode_KIND(pystr);
     end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
 
-    if (has_pairs_hook)
+    if (has_pairs_hook) {
         rval = PyList_New(0);
-    else
-        rval = PyDict_New();
-    if (rval == NULL)
-        return NULL;
+        if (rval == NULL)
+            return NULL;
+    }
 
     /* skip whitespace after { */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind,str, idx))) idx++;
@@ -802,7 +852,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ss
             while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
 
             /* read any JSON term */
-            val = scan_once_unicode(s, memo, pystr, idx, &next_idx);
+            val = scan_once_unicode(s, memo, templates, pystr, idx, &next_idx);
             if (val == NULL)
                 goto bail;
 
@@ -817,7 +867,18 @@ _parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ss
                 }
                 Py_DECREF(item);
             }
+            else if (rval == NULL && nitems < OBJECT_ITEMS_MAX) {
+                keys[nitems] = key;
+                values[nitems] = val;
+                nitems++;
+                key = val = NULL;
+            }
             else {
+                if (rval == NULL) {
+                    rval = _PyDict_FromItems(keys, 1, values, 1, nitems);
+                    if (rval == NULL)
+                        goto bail;
+                }
                 if (PyDict_SetItem(rval, key, val) < 0)
                     goto bail;
                 Py_CLEAR(key);
@@ -856,6 +917,16 @@ _parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ss
         return val;
     }
 
+    if (rval == NULL) {
+        rval = _build_object(templates, keys, values, nitems);
+        if (rval == NULL)
+            goto bail;
+    }
+    for (Py_ssize_t i = 0; i < nitems; i++) {
+        Py_DECREF(keys[i]);
+        Py_DECREF(values[i]);
+    }
+
     /* if object_hook is not None: rval = object_hook(rval) */
     if (s->object_hook != Py_None) {
         val = PyObject_CallOneArg(s->object_hook, rval);
@@ -867,11 +938,15 @@ _parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ss
     Py_XDECREF(key);
     Py_XDECREF(val);
     Py_XDECREF(rval);
+    for (Py_ssize_t i = 0; i < nitems; i++) {
+        Py_DECREF(keys[i]);
+        Py_DECREF(values[i]);
+    }
     return NULL;
 }
 
 static PyObject *
-_parse_array_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr) {
+_parse_array_unicode(PyScannerObject *s, PyObject *memo, PyObject *templates, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr) {
     /* Read a JSON array from PyUnicode pystr.
     idx is the index of the first character after the opening brace.
     *next_idx_ptr is a return-by-reference index to the first character after
@@ -903,7 +978,7 @@ _parse_array_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssi
         while (1) {
 
             /* read any JSON term  */
-            val = scan_once_unicode(s, memo, pystr, idx, &next_idx);
+            val = scan_once_unicode(s, memo, templates, pystr, idx, &next_idx);
             if (val == NULL)
                 goto bail;
 
@@ -1096,7 +1171,7 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
 }
 
 static PyObject *
-scan_once_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
+scan_once_unicode(PyScannerObject *s, PyObject *memo, PyObject *templates, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
 {
     /* Read one JSON term (of any kind) from PyUnicode pystr.
     idx is the index of the first character of the term
@@ -1132,7 +1207,7 @@ scan_once_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssize_
             if (_Py_EnterRecursiveCall(" while decoding a JSON object "
                                        "from a unicode string"))
                 return NULL;
-            res = _parse_object_unicode(s, memo, pystr, idx + 1, next_idx_ptr);
+            res = _parse_object_unicode(s, memo, templates, pystr, idx + 1, next_idx_ptr);
             _Py_LeaveRecursiveCall();
             return res;
         case '[':
@@ -1140,7 +1215,7 @@ scan_once_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ssize_
             if (_Py_EnterRecursiveCall(" while decoding a JSON array "
                                        "from a unicode string"))
                 return NULL;
-            res = _parse_array_unicode(s, memo, pystr, idx + 1, next_idx_ptr);
+            res = _parse_array_unicode(s, memo, templates, pystr, idx + 1, next_idx_ptr);
             _Py_LeaveRecursiveCall();
             return res;
         case 'n':
@@ -1227,9 +1302,15 @@ scanner_call(PyObject *self, PyObject *args, PyObject *kwds)
     if (memo == NULL) {
         return NULL;
     }
+    PyObject *templates = PyDict_New();
+    if (templates == NULL) {
+        Py_DECREF(memo);
+        return NULL;
+    }
     rval = scan_once_unicode(PyScannerObject_CAST(self),
-                             memo, pystr, idx, &next_idx);
+                             memo, templates, pystr, idx, &next_idx);
     Py_DECREF(memo);
+    Py_DECREF(templates);
     if (rval == NULL)
         return NULL;
     return _build_rval_index_tuple(rval, next_idx);
@@ -2134,6 +2134,37 @@ dict_getitem_knownhash(PyObject *self, PyObject *args)
 }
 
 
+static PyObject*
+dict_from_template(PyObject *self, PyObject *args)
+{
+    PyObject *template, *keys, *values;
+
+    if (!PyArg_ParseTuple(args, "O!O!O!:dict_from_template",
+                          &PyDict_Type, &template,
+                          &PyTuple_Type, &keys, &PyTuple_Type, &values)) {
+        return NULL;
+    }
+    if (!PyDict_CheckExact(template)) {
+        PyErr_SetString(PyExc_TypeError, "template must be a dict");
+        return NULL;
+    }
+    if (PyTuple_GET_SIZE(keys) != PyTuple_GET_SIZE(values)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "keys and values must have the same length");
+        return NULL;
+    }
+
+    PyObject *result;
+    Py_BEGIN_CRITICAL_SECTION(template);
+    result = _PyDict_FromTemplate(template,
+                                  PySequence_Fast_ITEMS(keys),
+                                  PySequence_Fast_ITEMS(values),
+                                  PyTuple_GET_SIZE(keys));
+    Py_END_CRITICAL_SECTION();
+    return result;
+}
+
+
 static int
 _init_interp_config_from_object(PyInterpreterConfig *config, PyObject *obj)
 {
@@ -2818,6 +2849,23 @@ get_long_lived_total(PyObject *self, PyObject *Py_UNUSED(ignored))
     return PyLong_FromInt64(PyInterpreterState_Get()->gc.long_lived_total);
 }
 
+static PyObject *
+set_gc_mark_alive_workers(PyObject *self, PyObject *arg)
+{
+    int workers = PyLong_AsInt(arg);
+    if (workers == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (workers < 0) {
+        PyErr_SetString(PyExc_ValueError, "workers must be >= 0");
+        return NULL;
+    }
+    PyInterpreterState *interp = PyInterpreterState_Get();
+    int old = interp->gc.mark_alive_workers;
+    interp->gc.mark_alive_workers = workers;
+    return PyLong_FromLong(old);
+}
+
 #endif
 
 static PyObject *
@@ -3257,6 +3305,7 @@ static PyMethodDef module_functions[] = {
     {"get_object_dict_values", get_object_dict_values, METH_O},
     {"hamt", new_hamt, METH_NOARGS},
     {"dict_getitem_knownhash",  dict_getitem_knownhash,          METH_VARARGS},
+    {"dict_from_template",      dict_from_template,              METH_VARARGS},
     {"create_interpreter", _PyCFunction_CAST(create_interpreter),
      METH_VARARGS | METH_KEYWORDS},
     {"destroy_interpreter", _PyCFunction_CAST(destroy_interpreter),
@@ -3292,6 +3341,7 @@ static PyMethodDef module_functions[] = {
     {"get_tlbc", get_tlbc, METH_O, NULL},
     {"get_tlbc_id", get_tlbc_id, METH_O, NULL},
     {"get_long_lived_total", get_long_lived_total, METH_NOARGS},
+    {"set_gc_mark_alive_workers", set_gc_mark_alive_workers, METH_O},
 #endif
 #ifdef _Py_TIER2
     {"uop_symbols_test", _Py_uop_symbols_test, METH_NOARGS},
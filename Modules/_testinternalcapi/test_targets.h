@@ -155,6 +155,9 @@ static void *opcode_targets_table[256] = {
     &&TARGET_CALL_EX_PY,
     &&TARGET_CALL_ISINSTANCE,
     &&TARGET_CALL_KW_BOUND_METHOD,
+    &&TARGET_CALL_KW_BUILTIN_CLASS,
+    &&TARGET_CALL_KW_BUILTIN_FAST,
+    &&TARGET_CALL_KW_METHOD_DESCRIPTOR_FAST,
     &&TARGET_CALL_KW_NON_PY,
     &&TARGET_CALL_KW_PY,
     &&TARGET_CALL_LEN,
@@ -230,9 +233,6 @@ static void *opcode_targets_table[256] = {
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
     &&TARGET_INSTRUMENTED_END_FOR,
     &&TARGET_INSTRUMENTED_POP_ITER,
     &&TARGET_INSTRUMENTED_END_SEND,
@@ -478,9 +478,9 @@ static void *opcode_tracing_targets_table[256] = {
     &&TARGET_TRACE_RECORD,
     &&TARGET_TRACE_RECORD,
     &&TARGET_TRACE_RECORD,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
+    &&TARGET_TRACE_RECORD,
+    &&TARGET_TRACE_RECORD,
+    &&TARGET_TRACE_RECORD,
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
@@ -574,6 +574,9 @@ static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_INTRINSIC_2(TAIL_CALL_PARAM
 static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_ISINSTANCE(TAIL_CALL_PARAMS);
 static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW(TAIL_CALL_PARAMS);
 static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW_BOUND_METHOD(TAIL_CALL_PARAMS);
+static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW_BUILTIN_CLASS(TAIL_CALL_PARAMS);
+static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW_BUILTIN_FAST(TAIL_CALL_PARAMS);
+static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW_METHOD_DESCRIPTOR_FAST(TAIL_CALL_PARAMS);
 static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW_NON_PY(TAIL_CALL_PARAMS);
 static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_KW_PY(TAIL_CALL_PARAMS);
 static PyObject *Py_PRESERVE_NONE_CC _TAIL_CALL_CALL_LEN(TAIL_CALL_PARAMS);
@@ -820,6 +823,9 @@ static py_tail_call_funcptr instruction_funcptr_handler_table[256] = {
     [CALL_ISINSTANCE] = _TAIL_CALL_CALL_ISINSTANCE,
     [CALL_KW] = _TAIL_CALL_CALL_KW,
     [CALL_KW_BOUND_METHOD] = _TAIL_CALL_CALL_KW_BOUND_METHOD,
+    [CALL_KW_BUILTIN_CLASS] = _TAIL_CALL_CALL_KW_BUILTIN_CLASS,
+    [CALL_KW_BUILTIN_FAST] = _TAIL_CALL_CALL_KW_BUILTIN_FAST,
+    [CALL_KW_METHOD_DESCRIPTOR_FAST] = _TAIL_CALL_CALL_KW_METHOD_DESCRIPTOR_FAST,
     [CALL_KW_NON_PY] = _TAIL_CALL_CALL_KW_NON_PY,
     [CALL_KW_PY] = _TAIL_CALL_CALL_KW_PY,
     [CALL_LEN] = _TAIL_CALL_CALL_LEN,
@@ -1019,9 +1025,6 @@ static py_tail_call_funcptr instruction_funcptr_handler_table[256] = {
     [125] = _TAIL_CALL_UNKNOWN_OPCODE,
     [126] = _TAIL_CALL_UNKNOWN_OPCODE,
     [127] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [219] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [220] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [221] = _TAIL_CALL_UNKNOWN_OPCODE,
     [222] = _TAIL_CALL_UNKNOWN_OPCODE,
     [223] = _TAIL_CALL_UNKNOWN_OPCODE,
     [224] = _TAIL_CALL_UNKNOWN_OPCODE,
@@ -1078,6 +1081,9 @@ static py_tail_call_funcptr instruction_funcptr_tracing_table[256] = {
     [CALL_ISINSTANCE] = _TAIL_CALL_TRACE_RECORD,
     [CALL_KW] = _TAIL_CALL_TRACE_RECORD,
     [CALL_KW_BOUND_METHOD] = _TAIL_CALL_TRACE_RECORD,
+    [CALL_KW_BUILTIN_CLASS] = _TAIL_CALL_TRACE_RECORD,
+    [CALL_KW_BUILTIN_FAST] = _TAIL_CALL_TRACE_RECORD,
+    [CALL_KW_METHOD_DESCRIPTOR_FAST] = _TAIL_CALL_TRACE_RECORD,
     [CALL_KW_NON_PY] = _TAIL_CALL_TRACE_RECORD,
     [CALL_KW_PY] = _TAIL_CALL_TRACE_RECORD,
     [CALL_LEN] = _TAIL_CALL_TRACE_RECORD,
@@ -1277,9 +1283,6 @@ static py_tail_call_funcptr instruction_funcptr_tracing_table[256] = {
     [125] = _TAIL_CALL_UNKNOWN_OPCODE,
     [126] = _TAIL_CALL_UNKNOWN_OPCODE,
     [127] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [219] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [220] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [221] = _TAIL_CALL_UNKNOWN_OPCODE,
     [222] = _TAIL_CALL_UNKNOWN_OPCODE,
     [223] = _TAIL_CALL_UNKNOWN_OPCODE,
     [224] = _TAIL_CALL_UNKNOWN_OPCODE,
@@ -207,4 +207,51 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=ed77cb69fad9f3b4 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_csv__dict_template__doc__,
+"_dict_template($module, keys, /)\n"
+"--\n"
+"\n"
+"Return an opaque template for building dicts with the given keys.\n"
+"\n"
+"For use by csv.DictReader with _dict_from_template().");
+
+#define _CSV__DICT_TEMPLATE_METHODDEF    \
+    {"_dict_template", (PyCFunction)_csv__dict_template, METH_O, _csv__dict_template__doc__},
+
+PyDoc_STRVAR(_csv__dict_from_template__doc__,
+"_dict_from_template($module, template, keys, values, /)\n"
+"--\n"
+"\n"
+"Return dict(zip(keys, values)), where keys and values have the same length.\n"
+"\n"
+"This is faster if keys are the keys of template, as returned by\n"
+"_dict_template().");
+
+#define _CSV__DICT_FROM_TEMPLATE_METHODDEF    \
+    {"_dict_from_template", _PyCFunction_CAST(_csv__dict_from_template), METH_FASTCALL, _csv__dict_from_template__doc__},
+
+static PyObject *
+_csv__dict_from_template_impl(PyObject *module, PyObject *capsule,
+                              PyObject *keys, PyObject *values);
+
+static PyObject *
+_csv__dict_from_template(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *capsule;
+    PyObject *keys;
+    PyObject *values;
+
+    if (!_PyArg_CheckPositional("_dict_from_template", nargs, 3, 3)) {
+        goto exit;
+    }
+    capsule = args[0];
+    keys = args[1];
+    values = args[2];
+    return_value = _csv__dict_from_template_impl(module, capsule, keys, values);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=21090f87ab6b3529 input=a9049054013a1b77]*/
@@ -443,19 +443,29 @@ gc_is_finalized_impl(PyObject *module, PyObject *obj)
 @permit_long_docstring_body
 gc.freeze
 
+    *
+    immortalize: bool = False
+
 Freeze all current tracked objects and ignore them for future collections.
 
 This can be used before a POSIX fork() call to make the gc copy-on-write friendly.
 Note: collection before a POSIX fork() call may free pages for future allocation
 which can cause copy-on-write.
+
+If immortalize is true, the frozen objects and the objects they refer to are
+also made immortal: their reference counts are no longer updated, and they are
+never deallocated.
 [clinic start generated code]*/
 
 static PyObject *
-gc_freeze_impl(PyObject *module)
-/*[clinic end generated code: output=502159d9cdc4c139 input=11fb59b0a75dcf3d]*/
+gc_freeze_impl(PyObject *module, int immortalize)
+/*[clinic end generated code: output=db32b5465626796f input=8d257a3e46cb0298]*/
 {
     PyInterpreterState *interp = _PyInterpreterState_GET();
     _PyGC_Freeze(interp);
+    if (immortalize && _PyGC_ImmortalizeFrozen(interp) < 0) {
+        return NULL;
+    }
     Py_RETURN_NONE;
 }
 
@@ -2425,6 +2425,10 @@ code_dealloc(PyObject *self)
     if (co->co_executors != NULL) {
         clear_executors(co);
     }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (interp->jit_samples != NULL) {
+        _PyJit_SampleForgetCode(interp, co);
+    }
 #endif
 
     Py_XDECREF(co->co_consts);
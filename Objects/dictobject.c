@@ -2339,6 +2339,152 @@ _PyDict_FromItems(PyObject *const *keys, Py_ssize_t keys_offset,
     return dict;
 }
 
+/* Return a new dict mapping each of keys[0:length] to None, to be passed to
+ * _PyDict_FromTemplate() for building many dicts with the same keys, such
+ * as rows of a table or records decoded from JSON.
+ *
+ * If the keys are distinct strings, and there are at most
+ * SHARED_KEYS_MAX_SIZE of them, the template has a split table whose keys
+ * object is sized to hold exactly these keys.  The dicts built from it then
+ * share that keys object, like the instance dicts of a class do, and only
+ * own a values array.  Since the shared keys have no room left, adding
+ * another key to one of those dicts converts it to a combined table.
+ */
+PyObject *
+_PyDict_NewTemplate(PyObject *const *keys, Py_ssize_t length)
+{
+    bool split = (length > 0 && length <= SHARED_KEYS_MAX_SIZE);
+    for (Py_ssize_t i = 0; split && i < length; i++) {
+        split = PyUnicode_CheckExact(keys[i]);
+    }
+    if (split) {
+        PyDictKeysObject *dk = new_keys_object(estimate_log2_keysize(length), 1);
+        if (dk == NULL) {
+            return NULL;
+        }
+        dk->dk_kind = DICT_KEYS_SPLIT;
+        for (Py_ssize_t i = 0; i < length; i++) {
+            Py_hash_t hash = unicode_get_hash(keys[i]);
+            if (hash == -1) {
+                hash = PyUnicode_Type.tp_hash(keys[i]);
+            }
+            if (insert_split_key(dk, keys[i], hash) != i) {
+                /* Duplicate key: fall back to a combined table. */
+                split = false;
+                break;
+            }
+        }
+        if (split) {
+            /* No further keys may be added to the shared keys. */
+            dk->dk_usable = 0;
+            PyDictObject *mp = (PyDictObject *)new_dict_with_shared_keys(dk);
+            dictkeys_decref(dk, false);
+            if (mp == NULL) {
+                return NULL;
+            }
+            for (Py_ssize_t i = 0; i < length; i++) {
+                mp->ma_values->values[i] = Py_None;
+                _PyDictValues_AddToInsertionOrder(mp->ma_values, i);
+            }
+            mp->ma_used = length;
+            ASSERT_CONSISTENT(mp);
+            return (PyObject *)mp;
+        }
+        dictkeys_decref(dk, false);
+    }
+    PyObject *none = Py_None;
+    return _PyDict_FromItems(keys, 1, &none, 0, length);
+}
+
+/* Return a new dict mapping keys[i] to values[i] for i in range(length).
+ *
+ * This is equivalent to _PyDict_FromItems(), but when keys are exactly the
+ * keys of template (the same objects, in the same order), the new dict is
+ * built without hashing or probing: it shares the keys object of a split
+ * template, or gets a copy of the keys table of a combined one.
+ */
+PyObject *
+_PyDict_FromTemplate(PyObject *template, PyObject *const *keys,
+                     PyObject *const *values, Py_ssize_t length)
+{
+    assert(PyDict_CheckExact(template));
+    PyDictObject *tp = (PyDictObject *)template;
+    PyDictKeysObject *dk = tp->ma_keys;
+
+    if (length == 0 || tp->ma_used != length || dk->dk_nentries != length) {
+        return _PyDict_FromItems(keys, 1, values, 1, length);
+    }
+    if (DK_IS_UNICODE(dk)) {
+        PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(dk);
+        for (Py_ssize_t i = 0; i < length; i++) {
+            if (ep[i].me_key != keys[i]) {
+                return _PyDict_FromItems(keys, 1, values, 1, length);
+            }
+        }
+    }
+    else {
+        PyDictKeyEntry *ep = DK_ENTRIES(dk);
+        for (Py_ssize_t i = 0; i < length; i++) {
+            if (ep[i].me_key != keys[i]) {
+                return _PyDict_FromItems(keys, 1, values, 1, length);
+            }
+        }
+    }
+
+    if (_PyDict_HasSplitTable(tp)) {
+        /* The new dict can only share the keys if it is sized for all of
+           them, and no more can be added: _PyDict_NewTemplate() ensures
+           this, but any split dict, such as an instance dict, may be
+           passed here.  Its values must also be in key order. */
+        if (FT_ATOMIC_LOAD_SSIZE_ACQUIRE(dk->dk_usable) != 0 ||
+            shared_keys_usable_size(dk) != (size_t)length)
+        {
+            return _PyDict_FromItems(keys, 1, values, 1, length);
+        }
+        for (Py_ssize_t i = 0; i < length; i++) {
+            if (get_index_from_order(tp, i) != i) {
+                return _PyDict_FromItems(keys, 1, values, 1, length);
+            }
+        }
+        PyDictValues *newvalues = new_values(length);
+        if (newvalues == NULL) {
+            return PyErr_NoMemory();
+        }
+        for (Py_ssize_t i = 0; i < length; i++) {
+            newvalues->values[i] = Py_NewRef(values[i]);
+            _PyDictValues_AddToInsertionOrder(newvalues, i);
+        }
+        dictkeys_incref(dk);
+        return new_dict(dk, newvalues, length, 1);
+    }
+
+    size_t keys_size = _PyDict_KeysSize(dk);
+    PyDictKeysObject *newkeys = PyMem_Malloc(keys_size);
+    if (newkeys == NULL) {
+        return PyErr_NoMemory();
+    }
+    memcpy(newkeys, dk, keys_size);
+    if (DK_IS_UNICODE(newkeys)) {
+        PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(newkeys);
+        for (Py_ssize_t i = 0; i < length; i++) {
+            Py_INCREF(ep[i].me_key);
+            ep[i].me_value = Py_NewRef(values[i]);
+        }
+    }
+    else {
+        PyDictKeyEntry *ep = DK_ENTRIES(newkeys);
+        for (Py_ssize_t i = 0; i < length; i++) {
+            Py_INCREF(ep[i].me_key);
+            ep[i].me_value = Py_NewRef(values[i]);
+        }
+    }
+    /* See clone_combined_dict_keys(). */
+#ifdef Py_REF_DEBUG
+    _Py_IncRefTotal(_PyThreadState_GET());
+#endif
+    return new_dict(newkeys, NULL, length, 0);
+}
+
 /* Note that, for historical reasons, PyDict_GetItem() suppresses all errors
  * that may occur (originally dicts supported only string keys, and exceptions
  * weren't possible).  So, while the original intent was that a NULL return
@@ -652,6 +652,31 @@ list_length(PyObject *a)
     return PyList_GET_SIZE(a);
 }
 
+/* PyObject_RichCompareBool(item, value, Py_EQ), with the comparison done
+   inline for the exact floats and compact ints that numeric lists hold.
+   value is NULL if PySequence_Contains() was misused: leave the error to
+   PyObject_RichCompareBool(). */
+static inline int
+list_item_eq(PyObject *item, PyObject *value)
+{
+    if (item == value) {
+        return 1;
+    }
+    if (value == NULL) {
+        return PyObject_RichCompareBool(item, value, Py_EQ);
+    }
+    if (PyFloat_CheckExact(item) && PyFloat_CheckExact(value)) {
+        return PyFloat_AS_DOUBLE(item) == PyFloat_AS_DOUBLE(value);
+    }
+    if (PyLong_CheckExact(item) && PyLong_CheckExact(value) &&
+        _PyLong_BothAreCompact((PyLongObject *)item, (PyLongObject *)value))
+    {
+        return _PyLong_CompactValue((PyLongObject *)item) ==
+               _PyLong_CompactValue((PyLongObject *)value);
+    }
+    return PyObject_RichCompareBool(item, value, Py_EQ);
+}
+
 static int
 list_contains(PyObject *aa, PyObject *el)
 {
@@ -662,7 +687,7 @@ list_contains(PyObject *aa, PyObject *el)
             // out-of-bounds
             return 0;
         }
-        int cmp = PyObject_RichCompareBool(item, el, Py_EQ);
+        int cmp = list_item_eq(item, el);
         Py_DECREF(item);
         if (cmp != 0) {
             return cmp;
@@ -2916,6 +2941,198 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Radix sort for lists whose keys are all compact ints or all floats.
+ *
+ * The keys are mapped to unsigned integers that order the same way, each
+ * paired with the key's position, and the pairs are sorted with a stable
+ * least-significant-byte-first radix sort.  Byte positions in which all
+ * keys agree are skipped, so small ints take only one or two passes.  The
+ * objects are then permuted into place.  See listsort.txt for when this is
+ * used instead of timsort.
+ */
+
+#define RADIX_MIN_SIZE 1024
+#define RADIX_BUCKETS 256
+
+/* Sort n packed words on their bytes [first, last).  Return the array
+   holding the result, which is either a or tmp. */
+static uint64_t *
+radix_sort_words(uint64_t *a, uint64_t *tmp, Py_ssize_t n, int first, int last)
+{
+    Py_ssize_t counts[8][RADIX_BUCKETS];
+    memset(counts, 0, sizeof(counts));
+    for (Py_ssize_t i = 0; i < n; i++) {
+        for (int b = first; b < last; b++) {
+            counts[b][(a[i] >> (8 * b)) & 0xff]++;
+        }
+    }
+    for (int b = first; b < last; b++) {
+        Py_ssize_t *count = counts[b];
+        if (count[(a[0] >> (8 * b)) & 0xff] == n) {
+            continue;  /* all the keys share this byte */
+        }
+        Py_ssize_t pos = 0;
+        for (int k = 0; k < RADIX_BUCKETS; k++) {
+            Py_ssize_t c = count[k];
+            count[k] = pos;
+            pos += c;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            tmp[count[(a[i] >> (8 * b)) & 0xff]++] = a[i];
+        }
+        uint64_t *t = a;
+        a = tmp;
+        tmp = t;
+    }
+    return a;
+}
+
+typedef struct {
+    uint64_t key;
+    Py_ssize_t index;
+} radix_item;
+
+/* Same as radix_sort_words(), for items with a full 64-bit key. */
+static radix_item *
+radix_sort_items(radix_item *a, radix_item *tmp, Py_ssize_t n)
+{
+    Py_ssize_t counts[8][RADIX_BUCKETS];
+    memset(counts, 0, sizeof(counts));
+    for (Py_ssize_t i = 0; i < n; i++) {
+        for (int b = 0; b < 8; b++) {
+            counts[b][(a[i].key >> (8 * b)) & 0xff]++;
+        }
+    }
+    for (int b = 0; b < 8; b++) {
+        Py_ssize_t *count = counts[b];
+        if (count[(a[0].key >> (8 * b)) & 0xff] == n) {
+            continue;
+        }
+        Py_ssize_t pos = 0;
+        for (int k = 0; k < RADIX_BUCKETS; k++) {
+            Py_ssize_t c = count[k];
+            count[k] = pos;
+            pos += c;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            tmp[count[(a[i].key >> (8 * b)) & 0xff]++] = a[i];
+        }
+        radix_item *t = a;
+        a = tmp;
+        tmp = t;
+    }
+    return a;
+}
+
+/* Sort lo->keys[0:n], and lo->values along with them, if every key is a
+ * compact int (is_float false) or a float (is_float true).  Return 1 if
+ * the slice was sorted, or 0 if timsort should be used instead: because
+ * the input looks presorted, a key is a NaN, or memory is short.
+ */
+static int
+radix_sort(sortslice *lo, Py_ssize_t n, int is_float)
+{
+    PyObject **keys = lo->keys;
+
+    assert(n >= 2);
+    /* Timsort is linear on input made of a few long runs, and radix sort
+       is not: count how often the direction between neighbours changes. */
+    Py_ssize_t turns = 0;
+    int dir = 0;
+    for (Py_ssize_t i = 1; i < n; i++) {
+        int d;
+        if (is_float) {
+            double v = PyFloat_AS_DOUBLE(keys[i]);
+            double w = PyFloat_AS_DOUBLE(keys[i - 1]);
+            if (isnan(v) || isnan(w)) {
+                /* NaNs are unordered; leave them to timsort. */
+                return 0;
+            }
+            d = (v > w) - (v < w);
+        }
+        else {
+            intptr_t v = _PyLong_CompactValue((PyLongObject *)keys[i]);
+            intptr_t w = _PyLong_CompactValue((PyLongObject *)keys[i - 1]);
+            d = (v > w) - (v < w);
+        }
+        if (d != 0) {
+            turns += (d != dir);
+            dir = d;
+        }
+    }
+    if (turns < n / 16) {
+        return 0;
+    }
+
+    if (!is_float) {
+#if SIZEOF_SIZE_T > 4
+        if ((size_t)n > UINT32_MAX) {
+            return 0;
+        }
+#endif
+        /* Pack the key into the high and the position into the low half
+           of a word, and sort on the high half only. */
+        Py_BUILD_ASSERT(PyLong_SHIFT < 32);
+        uint64_t *a = PyMem_Malloc(2 * n * sizeof(uint64_t));
+        if (a == NULL) {
+            return 0;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            intptr_t v = _PyLong_CompactValue((PyLongObject *)keys[i]);
+            /* Compact ints have a single digit. */
+            assert(v >= INT32_MIN && v <= INT32_MAX);
+            uint64_t k = (uint32_t)(int32_t)v ^ 0x80000000u;
+            a[i] = (k << 32) | (uint64_t)i;
+        }
+        uint64_t *res = radix_sort_words(a, a + n, n, 4, 8);
+        PyObject **scratch = (PyObject **)(res == a ? a + n : a);
+        for (Py_ssize_t i = 0; i < n; i++) {
+            scratch[i] = keys[res[i] & 0xffffffffu];
+        }
+        memcpy(keys, scratch, n * sizeof(PyObject *));
+        if (lo->values != NULL) {
+            for (Py_ssize_t i = 0; i < n; i++) {
+                scratch[i] = lo->values[res[i] & 0xffffffffu];
+            }
+            memcpy(lo->values, scratch, n * sizeof(PyObject *));
+        }
+        PyMem_Free(a);
+        return 1;
+    }
+
+    radix_item *a = PyMem_Malloc(2 * n * sizeof(radix_item));
+    if (a == NULL) {
+        return 0;
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        double v = PyFloat_AS_DOUBLE(keys[i]);
+        uint64_t k;
+        if (v == 0.0) {
+            v = 0.0;  /* -0.0 and 0.0 compare equal */
+        }
+        memcpy(&k, &v, sizeof(k));
+        /* Flip negative numbers entirely and set the sign bit of positive
+           ones, so that unsigned order is numeric order. */
+        k ^= (k >> 63) ? ~(uint64_t)0 : (uint64_t)1 << 63;
+        a[i].key = k;
+        a[i].index = i;
+    }
+    radix_item *res = radix_sort_items(a, a + n, n);
+    PyObject **scratch = (PyObject **)(res == a ? a + n : a);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        scratch[i] = keys[res[i].index];
+    }
+    memcpy(keys, scratch, n * sizeof(PyObject *));
+    if (lo->values != NULL) {
+        for (Py_ssize_t i = 0; i < n; i++) {
+            scratch[i] = lo->values[res[i].index];
+        }
+        memcpy(lo->values, scratch, n * sizeof(PyObject *));
+    }
+    PyMem_Free(a);
+    return 1;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -3117,6 +3334,15 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
+    if (saved_ob_size >= RADIX_MIN_SIZE &&
+        (ms.key_compare == unsafe_long_compare ||
+         ms.key_compare == unsafe_float_compare) &&
+        radix_sort(&lo, saved_ob_size,
+                   ms.key_compare == unsafe_float_compare))
+    {
+        goto succeed;
+    }
+
     /* March over the array once, left to right, finding natural runs,
      * and extending short natural runs to minrun elements.
      */
@@ -3343,7 +3569,7 @@ list_index_impl(PyListObject *self, PyObject *value, Py_ssize_t start,
             // out-of-bounds
             break;
         }
-        int cmp = PyObject_RichCompareBool(obj, value, Py_EQ);
+        int cmp = list_item_eq(obj, value);
         Py_DECREF(obj);
         if (cmp > 0)
             return PyLong_FromSsize_t(i);
@@ -3374,12 +3600,7 @@ list_count_impl(PyListObject *self, PyObject *value)
             // out-of-bounds
             break;
         }
-        if (obj == value) {
-           count++;
-           Py_DECREF(obj);
-           continue;
-        }
-        int cmp = PyObject_RichCompareBool(obj, value, Py_EQ);
+        int cmp = list_item_eq(obj, value);
         Py_DECREF(obj);
         if (cmp > 0)
             count++;
@@ -84,6 +84,12 @@ maybe_small_long(PyLongObject *v)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* When both operands have more than TOOM3_CUTOFF digits and similar sizes,
+ * switch from Karatsuba to Toom-3 (toom3_mul), which splits the operands in
+ * three pieces instead of two.
+ */
+#define TOOM3_CUTOFF 200
+
 /* For exponentiation, use the binary left-to-right algorithm unless the
  ^ exponent contains more than HUGE_EXP_CUTOFF bits.  In that case, do
  * (no more than) EXP_WINDOW_SIZE bits at a time.  The potential drawback is
@@ -4061,6 +4067,7 @@ kmul_split(PyLongObject *n,
 }
 
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *toom3_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
@@ -4119,6 +4126,10 @@ k_mul(PyLongObject *a, PyLongObject *b)
     if (2 * asize <= bsize)
         return k_lopsided_mul(a, b);
 
+    /* Large operands of similar sizes are faster with Toom-3. */
+    if (asize > TOOM3_CUTOFF && 3 * asize > 2 * bsize)
+        return toom3_mul(a, b);
+
     /* Split a & b into hi & lo pieces. */
     shift = bsize >> 1;
     if (kmul_split(a, shift, &ah, &al) < 0) goto fail;
@@ -4272,6 +4283,239 @@ clearly >= each of ah*bh and al*bl, there's always enough room to subtract
 ah*bh and al*bl too.
 */
 
+/* A helper for Toom-3 multiplication (toom3_mul).  Splits abs(n) in three
+   pieces such that abs(n) == (p2 << 2*size) + (p1 << size) + p0, viewing the
+   shifts as being by digits.  The return values are >= 0.
+   Returns 0 on success, -1 on failure.
+*/
+static int
+toom3_split(PyLongObject *n, Py_ssize_t size, PyLongObject *p[3])
+{
+    PyLongObject *hi;
+
+    if (kmul_split(n, size, &hi, &p[0]) < 0)
+        return -1;
+    if (kmul_split(hi, size, &p[2], &p[1]) < 0) {
+        Py_DECREF(hi);
+        Py_CLEAR(p[0]);
+        return -1;
+    }
+    Py_DECREF(hi);
+    return 0;
+}
+
+/* Evaluate the polynomial p[0] + p[1]*x + p[2]*x**2 at x = 1, -1 and -2,
+   and store the results in v[0], v[1] and v[2].  The values at x = 0 and
+   infinity are p[0] and p[2].  Returns 0 on success, -1 on failure.
+*/
+static int
+toom3_evaluate(PyLongObject *p[3], PyLongObject *v[3])
+{
+    PyLongObject *t, *u;
+
+    v[0] = v[1] = v[2] = NULL;
+    /* v(1) = p0 + p1 + p2, v(-1) = p0 - p1 + p2 */
+    if ((t = long_add(p[0], p[2])) == NULL)
+        return -1;
+    v[0] = long_add(t, p[1]);
+    v[1] = long_sub(t, p[1]);
+    Py_DECREF(t);
+    if (v[0] == NULL || v[1] == NULL)
+        goto fail;
+    /* v(-2) = p0 - 2*p1 + 4*p2 = 2*(v(-1) + p2) - p0 */
+    if ((t = long_add(v[1], p[2])) == NULL)
+        goto fail;
+    u = long_add(t, t);
+    Py_DECREF(t);
+    if (u == NULL)
+        goto fail;
+    v[2] = long_sub(u, p[0]);
+    Py_DECREF(u);
+    if (v[2] == NULL)
+        goto fail;
+    return 0;
+
+  fail:
+    Py_CLEAR(v[0]);
+    Py_CLEAR(v[1]);
+    return -1;
+}
+
+/* Signed product of a and b, which may be negative here (unlike in k_mul). */
+static PyLongObject *
+toom3_signed_mul(PyLongObject *a, PyLongObject *b)
+{
+    PyLongObject *z = k_mul(a, b);
+    if (z != NULL && _PyLong_IsNegative(a) != _PyLong_IsNegative(b))
+        _PyLong_Negate(&z);
+    return z;
+}
+
+/* Divide a by the digit n, which is known to divide it exactly.  Unlike
+   divrem1(), the sign of a is kept. */
+static PyLongObject *
+toom3_divexact(PyLongObject *a, digit n)
+{
+    digit rem;
+    PyLongObject *z;
+
+    if (_PyLong_IsCompact(a)) {
+        assert(medium_value(a) % (stwodigits)n == 0);
+        return _PyLong_FromSTwoDigits(medium_value(a) / (stwodigits)n);
+    }
+    z = divrem1(a, n, &rem);
+    assert(z == NULL || rem == 0);
+    if (z != NULL && _PyLong_IsNegative(a))
+        _PyLong_Negate(&z);
+    return z;
+}
+
+/* Toom-3 multiplication.  Ignores the input signs, and returns the absolute
+ * value of the product (or NULL if error).
+ *
+ * Both operands are split in three pieces of k digits, viewing them as
+ * polynomials a(x) = a2*x**2 + a1*x + a0 evaluated at x = BASE**k.  The
+ * product polynomial r(x) = a(x)*b(x) has degree 4, and is determined by
+ * its values at the five points 0, 1, -1, -2 and infinity.  Those take five
+ * multiplications of k-digit numbers, where the gradeschool method needs
+ * nine and Karatsuba (applied twice) about six.  The coefficients of r are
+ * recovered from these values with additions, shifts and exact divisions by
+ * 3, using the interpolation sequence of Bodrato and Zanoni, "Integer and
+ * Polynomial Multiplication: Towards Optimal Toom-Cook Matrices" (2007).
+ *
+ * This is asymptotically O(n**1.465) instead of Karatsuba's O(n**1.585);
+ * k_mul() calls it when both operands have more than TOOM3_CUTOFF digits
+ * and similar sizes.
+ */
+static PyLongObject *
+toom3_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = _PyLong_DigitCount(a);
+    const Py_ssize_t bsize = _PyLong_DigitCount(b);
+    PyLongObject *ap[3] = {NULL, NULL, NULL};
+    PyLongObject *bp[3] = {NULL, NULL, NULL};
+    PyLongObject *av[3] = {NULL, NULL, NULL};
+    PyLongObject *bv[3] = {NULL, NULL, NULL};
+    /* r[0..4]: values of the product polynomial at 0, 1, -1, -2 and
+       infinity, turned into its coefficients in place. */
+    PyLongObject *r[5] = {NULL, NULL, NULL, NULL, NULL};
+    PyLongObject *ret = NULL;
+    PyLongObject *t;
+    Py_ssize_t k, i;
+
+    assert(asize <= bsize);
+    assert(asize > TOOM3_CUTOFF);
+    assert(3 * asize > 2 * bsize);
+
+    /* Split a & b into three pieces, and evaluate them. */
+    k = (bsize + 2) / 3;
+    if (toom3_split(a, k, ap) < 0) goto fail;
+    if (toom3_evaluate(ap, av) < 0) goto fail;
+    if (a == b) {
+        for (i = 0; i < 3; i++) {
+            bp[i] = (PyLongObject*)Py_NewRef(ap[i]);
+            bv[i] = (PyLongObject*)Py_NewRef(av[i]);
+        }
+    }
+    else {
+        if (toom3_split(b, k, bp) < 0) goto fail;
+        if (toom3_evaluate(bp, bv) < 0) goto fail;
+    }
+
+    /* Pointwise products.  When squaring, these pass the same object
+       twice, so that k_mul() can use its cheaper squaring cutoff. */
+    if ((r[0] = k_mul(ap[0], a == b ? ap[0] : bp[0])) == NULL) goto fail;
+    for (i = 0; i < 3; i++) {
+        r[i + 1] = toom3_signed_mul(av[i], a == b ? av[i] : bv[i]);
+        if (r[i + 1] == NULL) goto fail;
+    }
+    if ((r[4] = k_mul(ap[2], a == b ? ap[2] : bp[2])) == NULL) goto fail;
+    for (i = 0; i < 3; i++) {
+        Py_CLEAR(ap[i]);
+        Py_CLEAR(bp[i]);
+        Py_CLEAR(av[i]);
+        Py_CLEAR(bv[i]);
+    }
+
+    /* Interpolation.  With r0 = r(0), r1 = r(1), r2 = r(-1), r3 = r(-2)
+       and r4 = r(inf):
+         r3 <- (r3 - r1) / 3
+         r1 <- (r1 - r2) / 2
+         r2 <- r2 - r0
+         r3 <- (r2 - r3) / 2 + 2*r4
+         r2 <- r2 + r1 - r4
+         r1 <- r1 - r3
+       and then r0..r4 are the coefficients of r, all >= 0. */
+    if ((t = long_sub(r[3], r[1])) == NULL) goto fail;
+    Py_SETREF(r[3], toom3_divexact(t, 3));
+    Py_DECREF(t);
+    if (r[3] == NULL) goto fail;
+
+    if ((t = long_sub(r[1], r[2])) == NULL) goto fail;
+    Py_SETREF(r[1], toom3_divexact(t, 2));
+    Py_DECREF(t);
+    if (r[1] == NULL) goto fail;
+
+    Py_SETREF(r[2], long_sub(r[2], r[0]));
+    if (r[2] == NULL) goto fail;
+
+    if ((t = long_sub(r[2], r[3])) == NULL) goto fail;
+    Py_SETREF(r[3], toom3_divexact(t, 2));
+    Py_DECREF(t);
+    if (r[3] == NULL) goto fail;
+    if ((t = long_add(r[4], r[4])) == NULL) goto fail;
+    Py_SETREF(r[3], long_add(r[3], t));
+    Py_DECREF(t);
+    if (r[3] == NULL) goto fail;
+
+    Py_SETREF(r[2], long_add(r[2], r[1]));
+    if (r[2] == NULL) goto fail;
+    Py_SETREF(r[2], long_sub(r[2], r[4]));
+    if (r[2] == NULL) goto fail;
+
+    Py_SETREF(r[1], long_sub(r[1], r[3]));
+    if (r[1] == NULL) goto fail;
+
+    /* Add the coefficients into the result at offsets of k digits.  Since
+       all of them are >= 0, the partial sums never exceed the product, which
+       fits in asize + bsize digits. */
+    ret = long_alloc(asize + bsize);
+    if (ret == NULL) goto fail;
+    memset(ret->long_value.ob_digit, 0, (asize + bsize) * sizeof(digit));
+    for (i = 0; i < 5; i++) {
+        Py_ssize_t size_r = _PyLong_DigitCount(r[i]);
+        Py_ssize_t avail = asize + bsize - i * k;
+        digit carry;
+
+        assert(!_PyLong_IsNegative(r[i]));
+        if (size_r == 0)
+            continue;
+        assert(size_r <= avail);
+        carry = v_iadd(ret->long_value.ob_digit + i * k, avail,
+                       r[i]->long_value.ob_digit, size_r);
+        assert(carry == 0);
+        (void)carry;
+        Py_CLEAR(r[i]);
+    }
+    for (i = 0; i < 5; i++) {
+        Py_XDECREF(r[i]);
+    }
+    return long_normalize(ret);
+
+  fail:
+    for (i = 0; i < 3; i++) {
+        Py_XDECREF(ap[i]);
+        Py_XDECREF(bp[i]);
+        Py_XDECREF(av[i]);
+        Py_XDECREF(bv[i]);
+    }
+    for (i = 0; i < 5; i++) {
+        Py_XDECREF(r[i]);
+    }
+    Py_XDECREF(ret);
+    return NULL;
+}
+
 /* b has at least twice the digits of a, and a is big enough that Karatsuba
  * would pay off *if* the inputs had balanced sizes.  View b as a sequence
  * of slices, each with the same number of digits as a, and multiply the
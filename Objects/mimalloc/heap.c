@@ -171,7 +171,7 @@ static void mi_heap_collect_ex(mi_heap_t* heap, mi_collect_t collect)
   _mi_abandoned_collect(heap, collect == MI_FORCE /* force? */, &heap->tld->segments);
 
   // collect segment local caches
-  if (force) {
+  if (collect == MI_FORCE) {
     _mi_segment_thread_collect(&heap->tld->segments);
   }
 
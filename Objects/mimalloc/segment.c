@@ -399,10 +399,22 @@ static void mi_segment_os_free(mi_segment_t* segment, mi_segments_tld_t* tld) {
   _mi_arena_free(segment, mi_segment_size(segment), csize, segment->memid, tld->stats);
 }
 
-// called by threads that are terminating
+// called by forced collections (`mi_collect(true)`), not when a thread terminates
 void _mi_segment_thread_collect(mi_segments_tld_t* tld) {
-  MI_UNUSED(tld);
-  // nothing to do
+  // purge the delayed decommits of this thread's segments with free spans now;
+  // a segment usually has several free spans, but it is only purged once: the
+  // purge clears its purge mask, and consecutive spans of a segment are skipped
+  mi_segment_t* last = NULL;
+  for (size_t i = 0; i <= MI_SEGMENT_BIN_MAX; i++) {
+    for (mi_slice_t* slice = tld->spans[i].first; slice != NULL; slice = slice->next) {
+      mi_segment_t* segment = _mi_ptr_segment(slice);
+      if (segment == last) continue;
+      last = segment;
+      if (!mi_commit_mask_is_empty(&segment->purge_mask)) {
+        mi_segment_try_purge(segment, true, tld->stats);
+      }
+    }
+  }
 }
 
 
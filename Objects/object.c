@@ -3,6 +3,7 @@
 
 #include "Python.h"
 #include "pycore_brc.h"           // _Py_brc_queue_object()
+#include "pycore_bytesobject.h"   // PyBytesWriter
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCallTstate()
 #include "pycore_context.h"       // _PyContextTokenMissing_Type
@@ -24,6 +25,7 @@
 #include "pycore_memoryobject.h"  // _PyManagedBuffer_Type
 #include "pycore_namespace.h"     // _PyNamespace_Type
 #include "pycore_object.h"        // export _Py_SwappedOp
+#include "pycore_object_stack.h"  // _PyObjectStackChunk
 #include "pycore_optimizer.h"     // _PyUOpExecutor_Type
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
 #include "pycore_pymem.h"         // _PyMem_IsPtrFreed()
@@ -3075,6 +3077,45 @@ _Py_GetObjects(PyObject *self, PyObject *args)
 Py_ssize_t (*_Py_abstract_hack)(PyObject *) = PyObject_Size;
 
 
+/* Print summary info about the freelists of the types which do not report
+   them themselves */
+static void
+freelists_debug_stats(FILE *out)
+{
+#define TYPE_STATS(NAME, BLOCK_NAME, TYPE) \
+    _PyDebugAllocatorStats(out, "free " BLOCK_NAME, \
+                           _Py_FREELIST_SIZE(NAME), \
+                           _PyType_PreHeaderSize(&TYPE) + (size_t)TYPE.tp_basicsize)
+    // Only the compact ints are saved.
+    _PyDebugAllocatorStats(out, "free PyLongObject",
+                           _Py_FREELIST_SIZE(ints), sizeof(PyLongObject));
+    TYPE_STATS(complexes, "PyComplexObject", PyComplex_Type);
+    TYPE_STATS(list_iters, "list_iterator", PyListIter_Type);
+    TYPE_STATS(tuple_iters, "tuple_iterator", PyTupleIter_Type);
+    TYPE_STATS(slices, "PySliceObject", PySlice_Type);
+    TYPE_STATS(ranges, "range", PyRange_Type);
+    TYPE_STATS(range_iters, "range_iterator", PyRangeIter_Type);
+    TYPE_STATS(contexts, "PyContext", PyContext_Type);
+    TYPE_STATS(async_gens, "_PyAsyncGenWrappedValue",
+               _PyAsyncGenWrappedValue_Type);
+    TYPE_STATS(async_gen_asends, "PyAsyncGenASend", _PyAsyncGenASend_Type);
+    TYPE_STATS(pycfunctionobject, "PyCFunctionObject", PyCFunction_Type);
+    TYPE_STATS(pycmethodobject, "PyCMethodObject", PyCMethod_Type);
+    TYPE_STATS(pymethodobjects, "PyMethodObject", PyMethod_Type);
+#undef TYPE_STATS
+    _PyDebugAllocatorStats(out, "free _PyObjectStackChunk",
+                           _Py_FREELIST_SIZE(object_stack_chunks),
+                           sizeof(_PyObjectStackChunk));
+    _PyDebugAllocatorStats(out, "free _PyUnicodeWriter",
+                           _Py_FREELIST_SIZE(unicode_writers),
+                           sizeof(_PyUnicodeWriter));
+    _PyDebugAllocatorStats(out, "free PyBytesWriter",
+                           _Py_FREELIST_SIZE(bytes_writers),
+                           sizeof(PyBytesWriter));
+    // The dict keys are reported by _PyDict_DebugMallocStats().  The future
+    // iterators are not reported: their type belongs to the _asyncio module.
+}
+
 void
 _PyObject_DebugTypeStats(FILE *out)
 {
@@ -3082,6 +3123,7 @@ _PyObject_DebugTypeStats(FILE *out)
     _PyFloat_DebugMallocStats(out);
     _PyList_DebugMallocStats(out);
     _PyTuple_DebugMallocStats(out);
+    freelists_debug_stats(out);
 }
 
 /* These methods are used to control infinite recursion in repr, str, print,
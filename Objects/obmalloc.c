@@ -3868,4 +3868,95 @@ _PyObject_DebugMallocStats(FILE *out)
     }
 }
 
+#ifdef WITH_MIMALLOC
+static size_t
+py_mimalloc_release_free_memory(void)
+{
+    int64_t committed = mi_atomic_loadi64_relaxed(&_mi_stats_main.committed.current);
+#ifdef Py_GIL_DISABLED
+    // Other threads' heaps can only be collected by their owner.
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    for (int i = 0; i < _Py_MIMALLOC_HEAP_COUNT; i++) {
+        mi_heap_collect(&tstate->mimalloc.heaps[i], true);
+    }
+    // The empty pages are only freed once no thread can still be reading
+    // them.  Report a quiescent state for this thread, like the GC does, so
+    // that they can be freed now if the other threads are quiescent as well.
+    _Py_qsbr_advance(tstate->qsbr->shared);
+    _Py_qsbr_quiescent_state(tstate->qsbr);
+    _PyMem_ProcessDelayed((PyThreadState *)tstate);
+    for (int i = 0; i < _Py_MIMALLOC_HEAP_COUNT; i++) {
+        mi_heap_collect(&tstate->mimalloc.heaps[i], true);
+    }
+#endif
+    mi_collect(true);
+    int64_t released = committed - mi_atomic_loadi64_relaxed(&_mi_stats_main.committed.current);
+    return released > 0 ? (size_t)released : 0;
+}
+#endif
+
+/* Return the pages of the free pools to the system, keeping the first page of
+ * each pool, which holds the pool header linking it in its arena's freepools.
+ * The blocks of a released pool read as zeros, so its szidx is reset to make
+ * the next user initialize it again.
+ */
+static size_t
+pymalloc_release_free_pools(OMState *state)
+{
+#if defined(ARENAS_USE_MMAP) && defined(MADV_DONTNEED)
+    if (_PyObject_Arena.alloc != _PyMem_ArenaAlloc) {
+        // A custom arena allocator may not map its arenas itself.
+        return 0;
+    }
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0 || page_size >= POOL_SIZE || POOL_SIZE % page_size) {
+        return 0;
+    }
+    size_t released = 0;
+    for (uint i = 0; i < maxarenas; ++i) {
+        // Skip arenas that are not currently allocated.
+        if (allarenas[i].address == 0) {
+            continue;
+        }
+        for (poolp pool = allarenas[i].freepools; pool != NULL;
+             pool = pool->nextpool)
+        {
+            if (pool->szidx == DUMMY_SIZE_IDX) {
+                // Already released.
+                continue;
+            }
+            pool->szidx = DUMMY_SIZE_IDX;
+            if (madvise((char *)pool + page_size, POOL_SIZE - page_size,
+                        MADV_DONTNEED) == 0) {
+                released += POOL_SIZE - page_size;
+            }
+        }
+    }
+    return released;
+#else
+    return 0;
+#endif
+}
+
+/* Return the free memory of the object allocator to the system, and return
+ * the number of bytes released.  Empty arenas are already freed as soon as
+ * they become empty, this releases the free pools of the arenas still in use.
+ */
+size_t
+_PyObject_ReleaseFreeMemory(void)
+{
+#ifdef WITH_MIMALLOC
+    if (_PyMem_MimallocEnabled()) {
+        return py_mimalloc_release_free_memory();
+    }
+    else
+#endif
+    if (_PyMem_PymallocEnabled()) {
+        return pymalloc_release_free_pools(get_state());
+    }
+    else {
+        return 0;
+    }
+}
+
 #endif /* #ifdef WITH_PYMALLOC */
@@ -16,6 +16,13 @@
 # error C 'size_t' size should be either 4 or 8!
 #endif
 
+/* Number of characters in a C 'size_t' */
+#define CHARS_PER_WORD (SIZEOF_SIZE_T / STRINGLIB_SIZEOF_CHAR)
+/* Mask to quickly check whether a C 'size_t' contains a non-ASCII
+   STRINGLIB_CHAR. */
+#define WORD_ASCII_MASK \
+    ((size_t)-1 / (STRINGLIB_CHAR)-1 * (STRINGLIB_CHAR)0xFFFFFF80)
+
 /* 10xxxxxx */
 #define IS_CONTINUATION_BYTE(ch) ((ch) >= 0x80 && (ch) < 0xC0)
 
@@ -43,6 +50,21 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                 /* Help register allocation */
                 const char *_s = s;
                 STRINGLIB_CHAR *_p = p;
+                /* Check four words at a time and widen them in one go */
+                while (end - _s >= 4 * SIZEOF_SIZE_T) {
+                    const size_t *w = (const size_t *) _s;
+                    if ((w[0] | w[1] | w[2] | w[3]) & ASCII_CHAR_MASK)
+                        break;
+#if STRINGLIB_SIZEOF_CHAR == 1
+                    memcpy(_p, _s, 4 * SIZEOF_SIZE_T);
+#else
+                    for (int k = 0; k < 4 * SIZEOF_SIZE_T; k++) {
+                        _p[k] = (unsigned char)_s[k];
+                    }
+#endif
+                    _s += 4 * SIZEOF_SIZE_T;
+                    _p += 4 * SIZEOF_SIZE_T;
+                }
                 while (_s + SIZEOF_SIZE_T <= end) {
                     /* Read a whole size_t at a time (either 4 or 8 bytes),
                        and do a fast unrolled copy if it only contains ASCII
@@ -296,6 +318,28 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
 
     Py_ssize_t i;                /* index into data of next input character */
     for (i = 0; i < size;) {
+        if (_Py_IS_ALIGNED(data + i, ALIGNOF_SIZE_T)) {
+            /* Fast path for runs of ASCII characters: check four words
+               at a time and narrow them to bytes in one go. */
+            const Py_ssize_t block = 4 * CHARS_PER_WORD;
+            while (size - i >= block) {
+                const size_t *w = (const size_t *) (data + i);
+                if ((w[0] | w[1] | w[2] | w[3]) & WORD_ASCII_MASK)
+                    break;
+#if STRINGLIB_SIZEOF_CHAR == 1
+                memcpy(p, data + i, block);
+#else
+                for (Py_ssize_t k = 0; k < block; k++) {
+                    p[k] = (char) data[i + k];
+                }
+#endif
+                i += block;
+                p += block;
+            }
+            if (i == size)
+                break;
+        }
+
         Py_UCS4 ch = data[i++];
 
         if (ch < 0x80) {
@@ -481,6 +525,9 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
 #endif
 }
 
+#undef CHARS_PER_WORD
+#undef WORD_ASCII_MASK
+
 /* The pattern for constructing UCS2-repeated masks. */
 #if SIZEOF_LONG == 8
 # define UCS2_REPEAT_MASK 0x0001000100010001ul
@@ -553,6 +553,92 @@ STRINGLIB(_two_way_count)(const STRINGLIB_CHAR *haystack,
 #undef LOG_STRING
 #undef LOG_LINEUP
 
+#if STRINGLIB_SIZEOF_CHAR == 1
+/* Search for short needles by filtering on two of their characters: the
+   first one, p[0], and the last one that differs from it, p[k].  For a
+   block of PAIR_BLOCK alignments i, _pair_block() computes whether any has
+   s[i] == p[0] and s[i+k] == p[k].  That loop has no branches and no
+   dependency between iterations, so the compiler turns it into SIMD
+   compares and an OR reduction.  Blocks with a candidate are then checked
+   alignment by alignment.
+
+   Unlike default_find() this does not skip ahead with the bloom mask, so
+   it is only used for needles short enough that the skip is small.  It is
+   limited to 1-byte characters, for which compilers reliably vectorize
+   the filter loop. */
+
+#define PAIR_MAX_NEEDLE 5
+#define PAIR_BLOCK 32
+
+static inline int
+STRINGLIB(_pair_block)(const STRINGLIB_CHAR *s, const STRINGLIB_CHAR *sk,
+                       STRINGLIB_CHAR p0, STRINGLIB_CHAR pk)
+{
+    int found = 0;
+    for (Py_ssize_t j = 0; j < PAIR_BLOCK; j++) {
+        found |= (s[j] == p0) & (sk[j] == pk);
+    }
+    return found;
+}
+
+static Py_ssize_t
+STRINGLIB(_pair_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                      const STRINGLIB_CHAR* p, Py_ssize_t m,
+                      Py_ssize_t maxcount, int mode)
+{
+    const Py_ssize_t w = n - m;
+    const Py_ssize_t mlast = m - 1;
+    const STRINGLIB_CHAR p0 = p[0];
+    Py_ssize_t k = mlast;
+    Py_ssize_t count = 0;
+    Py_ssize_t i = 0;
+
+    assert(m >= 2);
+    while (k > 1 && p[k] == p0) {
+        k--;
+    }
+    const STRINGLIB_CHAR pk = p[k];
+    const STRINGLIB_CHAR *const sk = s + k;
+
+    while (w - i >= PAIR_BLOCK) {
+        if (!STRINGLIB(_pair_block)(s + i, sk + i, p0, pk)) {
+            i += PAIR_BLOCK;
+            continue;
+        }
+        for (Py_ssize_t stop = i + PAIR_BLOCK; i < stop; i++) {
+            if (s[i] == p0 && sk[i] == pk &&
+                memcmp(s + i + 1, p + 1, mlast) == 0)
+            {
+                if (mode != FAST_COUNT) {
+                    return i;
+                }
+                count++;
+                if (count == maxcount) {
+                    return maxcount;
+                }
+                i += mlast;
+            }
+        }
+    }
+    for (; i <= w; i++) {
+        if (s[i] == p0 && sk[i] == pk && memcmp(s + i + 1, p + 1, mlast) == 0) {
+            if (mode != FAST_COUNT) {
+                return i;
+            }
+            count++;
+            if (count == maxcount) {
+                return maxcount;
+            }
+            i += mlast;
+        }
+    }
+    return mode == FAST_COUNT ? count : -1;
+}
+
+#undef PAIR_BLOCK
+#endif /* STRINGLIB_SIZEOF_CHAR == 1 */
+
+
 static inline Py_ssize_t
 STRINGLIB(default_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
                         const STRINGLIB_CHAR* p, Py_ssize_t m,
@@ -798,6 +884,11 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
 
     if (mode != FAST_RSEARCH) {
         if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
+#ifdef PAIR_MAX_NEEDLE
+            if (m <= PAIR_MAX_NEEDLE) {
+                return STRINGLIB(_pair_find)(s, n, p, m, maxcount, mode);
+            }
+#endif
             return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
         }
         else if ((m >> 2) * 3 < (n >> 2)) {
@@ -828,3 +919,4 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 }
 
+#undef PAIR_MAX_NEEDLE
@@ -27,6 +27,12 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
         if (_Py_IS_ALIGNED(p, ALIGNOF_SIZE_T)) {
             /* Help register allocation */
             const unsigned char *_p = p;
+            while (_end - _p >= 4 * SIZEOF_SIZE_T) {
+                const size_t *w = (const size_t *) _p;
+                if ((w[0] | w[1] | w[2] | w[3]) & UCS1_ASCII_CHAR_MASK)
+                    return 255;
+                _p += 4 * SIZEOF_SIZE_T;
+            }
             while (_p + SIZEOF_SIZE_T <= _end) {
                 size_t value = *(const size_t *) _p;
                 if (value & UCS1_ASCII_CHAR_MASK)
@@ -56,6 +62,12 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
 #define MAX_CHAR_UCS2  0xffff
 #define MAX_CHAR_UCS4  0x10ffff
 
+/* Number of characters in a C 'size_t' */
+#define CHARS_PER_WORD (SIZEOF_SIZE_T / STRINGLIB_SIZEOF_CHAR)
+/* Repeat a character mask for every character of a C 'size_t' */
+#define WORD_MASK(mask) \
+    ((size_t)-1 / (STRINGLIB_CHAR)-1 * (STRINGLIB_CHAR)(mask))
+
 Py_LOCAL_INLINE(Py_UCS4)
 STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
 {
@@ -69,36 +81,31 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
 #error Invalid STRINGLIB_SIZEOF_CHAR (must be 1, 2 or 4)
 #endif
     Py_UCS4 mask;
-    Py_ssize_t n = end - begin;
     const STRINGLIB_CHAR *p = begin;
-    const STRINGLIB_CHAR *unrolled_end = begin + _Py_SIZE_ROUND_DOWN(n, 4);
     Py_UCS4 max_char;
 
     max_char = MAX_CHAR_ASCII;
     mask = MASK_ASCII;
-    while (p < unrolled_end) {
-        STRINGLIB_CHAR bits = p[0] | p[1] | p[2] | p[3];
-        if (bits & mask) {
-            if (mask == mask_limit) {
-                /* Limit reached */
-                return max_char_limit;
-            }
-            if (mask == MASK_ASCII) {
-                max_char = MAX_CHAR_UCS1;
-                mask = MASK_UCS1;
+    while (p < end) {
+        if (_Py_IS_ALIGNED(p, ALIGNOF_SIZE_T)) {
+            /* Help register allocation */
+            const STRINGLIB_CHAR *_p = p;
+            const size_t word_mask = WORD_MASK(mask);
+            while (end - _p >= 4 * CHARS_PER_WORD) {
+                const size_t *w = (const size_t *) _p;
+                if ((w[0] | w[1] | w[2] | w[3]) & word_mask)
+                    break;
+                _p += 4 * CHARS_PER_WORD;
             }
-            else {
-                /* mask can't be MASK_UCS2 because of mask_limit above */
-                assert(mask == MASK_UCS1);
-                max_char = MAX_CHAR_UCS2;
-                mask = MASK_UCS2;
+            while (end - _p >= CHARS_PER_WORD) {
+                if (*(const size_t *) _p & word_mask)
+                    break;
+                _p += CHARS_PER_WORD;
             }
-            /* We check the new mask on the same chars in the next iteration */
-            continue;
+            p = _p;
+            if (p == end)
+                break;
         }
-        p += 4;
-    }
-    while (p < end) {
         if (p[0] & mask) {
             if (mask == mask_limit) {
                 /* Limit reached */
@@ -129,6 +136,8 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
 #undef MAX_CHAR_UCS1
 #undef MAX_CHAR_UCS2
 #undef MAX_CHAR_UCS4
+#undef CHARS_PER_WORD
+#undef WORD_MASK
 
 #endif /* STRINGLIB_SIZEOF_CHAR == 1 */
 
@@ -5005,6 +5005,17 @@ find_first_nonascii(const unsigned char *start, const unsigned char *end)
         }
 #endif
 
+        // Test four words per iteration: the loop body has a single
+        // branch, and compilers turn it into vector code.  The word that
+        // holds the non-ASCII byte is then located by the loop below.
+        while (end - p >= 4 * SIZEOF_SIZE_T) {
+            const size_t *w = (const size_t *)p;
+            if ((w[0] | w[1] | w[2] | w[3]) & ASCII_CHAR_MASK) {
+                break;
+            }
+            p += 4 * SIZEOF_SIZE_T;
+        }
+
         const unsigned char *e = end - SIZEOF_SIZE_T;
         while (p <= e) {
             size_t u = (*(const size_t *)p) & ASCII_CHAR_MASK;
@@ -5101,6 +5112,14 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
            an explanation. */
         const char *p = start;
         Py_UCS1 *q = dest;
+        while (end - p >= 4 * SIZEOF_SIZE_T) {
+            const size_t *w = (const size_t *)p;
+            if ((w[0] | w[1] | w[2] | w[3]) & ASCII_CHAR_MASK)
+                break;
+            memcpy(q, p, 4 * SIZEOF_SIZE_T);
+            p += 4 * SIZEOF_SIZE_T;
+            q += 4 * SIZEOF_SIZE_T;
+        }
         while (p + SIZEOF_SIZE_T <= end) {
             size_t value = *(const size_t *) p;
             if (value & ASCII_CHAR_MASK)
@@ -2028,6 +2028,25 @@ builtin_locals_impl(PyObject *module)
 }
 
 
+/* PyObject_RichCompareBool(v, w, op) for op Py_LT or Py_GT, with the
+   comparison done inline for exact floats and compact ints. */
+static inline int
+min_max_compare(PyObject *v, PyObject *w, int op)
+{
+    if (PyFloat_CheckExact(v) && PyFloat_CheckExact(w)) {
+        double a = PyFloat_AS_DOUBLE(v), b = PyFloat_AS_DOUBLE(w);
+        return op == Py_LT ? a < b : a > b;
+    }
+    if (PyLong_CheckExact(v) && PyLong_CheckExact(w) &&
+        _PyLong_BothAreCompact((PyLongObject *)v, (PyLongObject *)w))
+    {
+        Py_ssize_t a = _PyLong_CompactValue((PyLongObject *)v);
+        Py_ssize_t b = _PyLong_CompactValue((PyLongObject *)w);
+        return op == Py_LT ? a < b : a > b;
+    }
+    return PyObject_RichCompareBool(v, w, op);
+}
+
 static PyObject *
 min_max(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, int op)
 {
@@ -2106,7 +2125,7 @@ min_max(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, int op)
         }
         /* maximum value and item are set; update them as necessary */
         else {
-            int cmp = PyObject_RichCompareBool(val, maxval, op);
+            int cmp = min_max_compare(val, maxval, op);
             if (cmp < 0)
                 goto Fail_it_item_and_val;
             else if (cmp > 0) {
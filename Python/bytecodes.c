@@ -942,6 +942,56 @@ dummy_func(
             INPUTS_DEAD();
         }
 
+        // Inplace float/compact int ops: emitted by the tier 2 optimizer for
+        // BINARY_OP_EXTEND when the float operand is uniquely referenced.
+        tier2 op(_BINARY_OP_ADD_FLOAT_INT_INPLACE, (left, right -- res, l, r)) {
+            FLOAT_INT_INPLACE_OP(left, right, +);
+            res = left;
+            l = PyStackRef_NULL;
+            r = right;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE, (left, right -- res, l, r)) {
+            FLOAT_INT_INPLACE_OP(left, right, -);
+            res = left;
+            l = PyStackRef_NULL;
+            r = right;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE, (left, right -- res, l, r)) {
+            FLOAT_INT_INPLACE_OP(left, right, *);
+            res = left;
+            l = PyStackRef_NULL;
+            r = right;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT, (left, right -- res, l, r)) {
+            INT_FLOAT_INPLACE_OP(left, right, +);
+            res = right;
+            l = left;
+            r = PyStackRef_NULL;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT, (left, right -- res, l, r)) {
+            INT_FLOAT_INPLACE_OP(left, right, -);
+            res = right;
+            l = left;
+            r = PyStackRef_NULL;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT, (left, right -- res, l, r)) {
+            INT_FLOAT_INPLACE_OP(left, right, *);
+            res = right;
+            l = left;
+            r = PyStackRef_NULL;
+            INPUTS_DEAD();
+        }
+
         pure op(_BINARY_OP_ADD_UNICODE, (left, right -- res, l, r)) {
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
             PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
@@ -962,6 +1012,28 @@ dummy_func(
         macro(BINARY_OP_ADD_UNICODE) =
             _GUARD_TOS_UNICODE + _GUARD_NOS_UNICODE + unused/5 + _BINARY_OP_ADD_UNICODE + _POP_TOP_UNICODE + _POP_TOP_UNICODE;
 
+        // Tier 2 only. The optimizer uses this when `left` is a temporary,
+        // such as the result of another concatenation or of BUILD_STRING,
+        // so a chain `a + b + c + ...` extends one string instead of
+        // allocating a new one per step. PyUnicode_Append only resizes
+        // `left` in place if it is really uniquely referenced, and
+        // concatenates otherwise.
+        tier2 op(_BINARY_OP_ADD_UNICODE_INPLACE, (left, right -- res, l, r)) {
+            assert(PyUnicode_CheckExact(PyStackRef_AsPyObjectBorrow(left)));
+            assert(PyUnicode_CheckExact(PyStackRef_AsPyObjectBorrow(right)));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *temp = PyStackRef_AsPyObjectSteal(left);
+            l = PyStackRef_NULL;
+            r = right;
+            INPUTS_DEAD();
+            PyUnicode_Append(&temp, PyStackRef_AsPyObjectBorrow(r));
+            if (temp == NULL) {
+                PyStackRef_CLOSE(r);
+                ERROR_NO_POP();
+            }
+            res = PyStackRef_FromPyObjectSteal(temp);
+        }
+
         // This is a subtle one. We write NULL to the local
         // of the following STORE_FAST and leave the result for STORE_FAST
         // later to store.
@@ -3644,6 +3716,9 @@ dummy_func(
             }
             assert(executor != tstate->interp->cold_executor);
             tstate->jit_exit = NULL;
+            if (tstate->interp->jit_samples != NULL) {
+                _PyJit_Sample(tstate, _PyJitSample_ENTER, frame, this_instr);
+            }
             TIER1_TO_TIER2(executor);
             #else
             Py_FatalError("ENTER_EXECUTOR is not supported in this build");
@@ -4882,7 +4957,8 @@ dummy_func(
             PyObject *res_o = _Py_CallBuiltinClass_StackRef(
                 callable,
                 arguments,
-                total_args);
+                total_args,
+                NULL);
             if (res_o == NULL) {
                 ERROR_NO_POP();
             }
@@ -4998,7 +5074,7 @@ dummy_func(
                 total_args++;
             }
             STAT_INC(CALL, hit);
-            PyObject *res_o = _Py_BuiltinCallFastWithKeywords_StackRef(callable, arguments, total_args);
+            PyObject *res_o = _Py_BuiltinCallFastWithKeywords_StackRef(callable, arguments, total_args, NULL);
             if (res_o == NULL) {
                 ERROR_NO_POP();
             }
@@ -5226,7 +5302,8 @@ dummy_func(
                 cfunc,
                 self,
                 arguments,
-                total_args
+                total_args,
+                NULL
             );
             if (res_o == NULL) {
                 ERROR_NO_POP();
@@ -5245,7 +5322,8 @@ dummy_func(
                 cfunc_v,
                 self,
                 args - 1,
-                oparg + 1
+                oparg + 1,
+                NULL
             );
             if (res_o == NULL) {
                 ERROR_NO_POP();
@@ -5412,6 +5490,9 @@ dummy_func(
             CALL_KW_BOUND_METHOD,
             CALL_KW_PY,
             CALL_KW_NON_PY,
+            CALL_KW_BUILTIN_CLASS,
+            CALL_KW_BUILTIN_FAST,
+            CALL_KW_METHOD_DESCRIPTOR_FAST,
         };
 
         op(_MONITOR_CALL_KW, (callable, self_or_null, args[oparg], unused -- callable, self_or_null, args[oparg], unused)) {
@@ -5641,6 +5722,146 @@ dummy_func(
             _CALL_KW_NON_PY +
             _CHECK_PERIODIC_AT_END;
 
+        /* Keyword calls of builtin classes and METH_FASTCALL | METH_KEYWORDS
+         * functions pass the kwnames tuple straight to the C implementation,
+         * instead of going through PyObject_Vectorcall. Like their CALL
+         * counterparts, they store the result in the callable's slot.
+         */
+        op(_GUARD_CALLABLE_BUILTIN_CLASS_KW, (callable, unused, unused[oparg], unused -- callable, unused, unused[oparg], unused)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
+            EXIT_IF(!PyType_Check(callable_o));
+            PyTypeObject *tp = (PyTypeObject *)callable_o;
+            EXIT_IF(tp->tp_vectorcall == NULL);
+        }
+
+        op(_CALL_KW_BUILTIN_CLASS, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+            int total_args = oparg;
+            _PyStackRef *arguments = args;
+            if (!PyStackRef_IsNull(self_or_null)) {
+                arguments--;
+                total_args++;
+            }
+            STAT_INC(CALL_KW, hit);
+            PyObject *res_o = _Py_CallBuiltinClass_StackRef(
+                callable,
+                arguments,
+                total_args,
+                PyStackRef_AsPyObjectBorrow(kwnames));
+            if (res_o == NULL) {
+                ERROR_NO_POP();
+            }
+            _PyStackRef temp = callable;
+            callable = PyStackRef_FromPyObjectSteal(res_o);
+            PyStackRef_CLOSE(temp);
+        }
+
+        macro(CALL_KW_BUILTIN_CLASS) =
+            _RECORD_CALLABLE_KW +
+            unused/1 +
+            unused/2 +
+            _GUARD_CALLABLE_BUILTIN_CLASS_KW +
+            _CALL_KW_BUILTIN_CLASS +
+            POP_TOP +
+            _POP_TOP_OPARG +
+            POP_TOP +
+            _CHECK_PERIODIC_AT_END;
+
+        op(_GUARD_CALLABLE_BUILTIN_FAST_KW, (callable, unused, unused[oparg], unused -- callable, unused, unused[oparg], unused)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
+            EXIT_IF(!PyCFunction_CheckExact(callable_o));
+            EXIT_IF(PyCFunction_GET_FLAGS(callable_o) != (METH_FASTCALL | METH_KEYWORDS));
+        }
+
+        op(_CALL_KW_BUILTIN_FAST, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+            int total_args = oparg;
+            _PyStackRef *arguments = args;
+            if (!PyStackRef_IsNull(self_or_null)) {
+                arguments--;
+                total_args++;
+            }
+            STAT_INC(CALL_KW, hit);
+            PyObject *res_o = _Py_BuiltinCallFastWithKeywords_StackRef(
+                callable,
+                arguments,
+                total_args,
+                PyStackRef_AsPyObjectBorrow(kwnames));
+            if (res_o == NULL) {
+                ERROR_NO_POP();
+            }
+            _PyStackRef temp = callable;
+            callable = PyStackRef_FromPyObjectSteal(res_o);
+            PyStackRef_CLOSE(temp);
+        }
+
+        macro(CALL_KW_BUILTIN_FAST) =
+            _RECORD_CALLABLE_KW +
+            unused/1 +
+            unused/2 +
+            _GUARD_CALLABLE_BUILTIN_FAST_KW +
+            _CALL_KW_BUILTIN_FAST +
+            POP_TOP +
+            _POP_TOP_OPARG +
+            POP_TOP +
+            _CHECK_PERIODIC_AT_END;
+
+        op(_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
+            PyMethodDescrObject *method = (PyMethodDescrObject *)callable_o;
+            EXIT_IF(!Py_IS_TYPE(method, &PyMethodDescr_Type));
+            EXIT_IF(method->d_method->ml_flags != (METH_FASTCALL|METH_KEYWORDS));
+            int total_args = oparg;
+            _PyStackRef *arguments = args;
+            if (!PyStackRef_IsNull(self_or_null)) {
+                arguments--;
+                total_args++;
+            }
+            // self must be passed positionally
+            EXIT_IF(total_args == PyTuple_GET_SIZE(PyStackRef_AsPyObjectBorrow(kwnames)));
+            PyObject *self = PyStackRef_AsPyObjectBorrow(arguments[0]);
+            EXIT_IF(!Py_IS_TYPE(self, method->d_common.d_type));
+        }
+
+        op(_CALL_KW_METHOD_DESCRIPTOR_FAST, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
+            PyMethodDescrObject *method = (PyMethodDescrObject *)callable_o;
+
+            int total_args = oparg;
+            _PyStackRef *arguments = args;
+            if (!PyStackRef_IsNull(self_or_null)) {
+                arguments--;
+                total_args++;
+            }
+            PyObject *self = PyStackRef_AsPyObjectBorrow(arguments[0]);
+            assert(self != NULL);
+            STAT_INC(CALL_KW, hit);
+            PyCFunctionFastWithKeywords cfunc = _PyCFunctionFastWithKeywords_CAST(method->d_method->ml_meth);
+            PyObject *res_o = _PyCallMethodDescriptorFastWithKeywords_StackRef(
+                callable,
+                cfunc,
+                self,
+                arguments,
+                total_args,
+                PyStackRef_AsPyObjectBorrow(kwnames)
+            );
+            if (res_o == NULL) {
+                ERROR_NO_POP();
+            }
+            _PyStackRef temp = callable;
+            callable = PyStackRef_FromPyObjectSteal(res_o);
+            PyStackRef_CLOSE(temp);
+        }
+
+        macro(CALL_KW_METHOD_DESCRIPTOR_FAST) =
+            _RECORD_CALLABLE_KW +
+            unused/1 +
+            unused/2 +
+            _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW +
+            _CALL_KW_METHOD_DESCRIPTOR_FAST +
+            POP_TOP +
+            _POP_TOP_OPARG +
+            POP_TOP +
+            _CHECK_PERIODIC_AT_END;
+
         family(CALL_FUNCTION_EX, INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX) = {
             CALL_EX_PY,
             CALL_EX_NON_PY_GENERAL,
@@ -6152,6 +6373,11 @@ dummy_func(
             JUMP_TO_JUMP_TARGET();
         }
 
+        /* Marks where _JUMP_TO_TOP re-enters a trace whose first loop
+         * iteration has been peeled. Removed before the trace is executed. */
+        tier2 op(_LOOP_HEAD, (--)) {
+        }
+
         tier2 op(_SET_IP, (instr_ptr/4 --)) {
             frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
         }
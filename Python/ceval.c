@@ -835,7 +835,8 @@ PyObject *
 _Py_BuiltinCallFastWithKeywords_StackRef(
     _PyStackRef callable,
     _PyStackRef *arguments,
-    int total_args)
+    int total_args,
+    PyObject *kwnames)
 {
     PyObject *res;
     STACKREFS_TO_PYOBJECTS(arguments, total_args, args_o);
@@ -845,7 +846,11 @@ _Py_BuiltinCallFastWithKeywords_StackRef(
     PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
     PyCFunctionFastWithKeywords cfunc =
         _PyCFunctionFastWithKeywords_CAST(PyCFunction_GET_FUNCTION(callable_o));
-    res = cfunc(PyCFunction_GET_SELF(callable_o), args_o, total_args, NULL);
+    int positional_args = total_args;
+    if (kwnames != NULL) {
+        positional_args -= (int)PyTuple_GET_SIZE(kwnames);
+    }
+    res = cfunc(PyCFunction_GET_SELF(callable_o), args_o, positional_args, kwnames);
     STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
     assert((res != NULL) ^ (PyErr_Occurred() != NULL));
     return res;
@@ -878,7 +883,8 @@ _PyCallMethodDescriptorFastWithKeywords_StackRef(
     PyCFunctionFastWithKeywords cfunc,
     PyObject *self,
     _PyStackRef *arguments,
-    int total_args)
+    int total_args,
+    PyObject *kwnames)
 {
     PyObject *res;
     STACKREFS_TO_PYOBJECTS(arguments, total_args, args_o);
@@ -887,7 +893,11 @@ _PyCallMethodDescriptorFastWithKeywords_StackRef(
     }
     assert(self == PyStackRef_AsPyObjectBorrow(arguments[0]));
 
-    res = cfunc(self, (args_o + 1), total_args-1, NULL);
+    int positional_args = total_args - 1;
+    if (kwnames != NULL) {
+        positional_args -= (int)PyTuple_GET_SIZE(kwnames);
+    }
+    res = cfunc(self, (args_o + 1), positional_args, kwnames);
     STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
     assert((res != NULL) ^ (PyErr_Occurred() != NULL));
     return res;
@@ -897,7 +907,8 @@ PyObject *
 _Py_CallBuiltinClass_StackRef(
     _PyStackRef callable,
     _PyStackRef *arguments,
-    int total_args)
+    int total_args,
+    PyObject *kwnames)
 {
     PyObject *res;
     STACKREFS_TO_PYOBJECTS(arguments, total_args, args_o);
@@ -905,7 +916,11 @@ _Py_CallBuiltinClass_StackRef(
         return NULL;
     }
     PyTypeObject *tp = (PyTypeObject *)PyStackRef_AsPyObjectBorrow(callable);
-    res = tp->tp_vectorcall((PyObject *)tp, args_o, total_args | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+    int positional_args = total_args;
+    if (kwnames != NULL) {
+        positional_args -= (int)PyTuple_GET_SIZE(kwnames);
+    }
+    res = tp->tp_vectorcall((PyObject *)tp, args_o, positional_args | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
     STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
     assert((res != NULL) ^ (PyErr_Occurred() != NULL));
     return res;
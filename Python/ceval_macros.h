@@ -444,6 +444,9 @@ do {                                                   \
         next_instr = frame->instr_ptr + 1;                 \
         JUMP_TO_LABEL(error);                          \
     }                                                  \
+    if (tstate->interp->jit_samples != NULL) {          \
+        _PyJit_Sample(tstate, _PyJitSample_EXIT, frame, next_instr); \
+    }                                                  \
     if (keep_tracing_bit) { \
         assert(uop_buffer_length(&((_PyThreadStateImpl *)tstate)->jit_tracer_state->code_buffer)); \
         ENTER_TRACING(); \
@@ -575,6 +578,38 @@ gen_try_set_executing(PyGenObject *gen)
             ->ob_fval = _dres;                                           \
     } while (0)
 
+// Inplace float/compact int binary ops (tier 2 only).
+// Mutates the uniquely-referenced float operand in place. The guard of
+// the BINARY_OP_EXTEND specialization has already checked that the other
+// operand is a compact int.
+#define FLOAT_INT_INPLACE_OP(left, right, OP)                            \
+    do {                                                                 \
+        PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);            \
+        PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);          \
+        assert(PyFloat_CheckExact(left_o));                              \
+        assert(_PyLong_CheckExactAndCompact(right_o));                   \
+        assert(_PyObject_IsUniquelyReferenced(left_o));                  \
+        STAT_INC(BINARY_OP, hit);                                        \
+        double _dres =                                                   \
+            ((PyFloatObject *)left_o)->ob_fval                           \
+            OP _PyLong_CompactValue((PyLongObject *)right_o);            \
+        ((PyFloatObject *)left_o)->ob_fval = _dres;                      \
+    } while (0)
+
+#define INT_FLOAT_INPLACE_OP(left, right, OP)                            \
+    do {                                                                 \
+        PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);            \
+        PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);          \
+        assert(_PyLong_CheckExactAndCompact(left_o));                    \
+        assert(PyFloat_CheckExact(right_o));                             \
+        assert(_PyObject_IsUniquelyReferenced(right_o));                 \
+        STAT_INC(BINARY_OP, hit);                                        \
+        double _dres =                                                   \
+            _PyLong_CompactValue((PyLongObject *)left_o)                 \
+            OP ((PyFloatObject *)right_o)->ob_fval;                      \
+        ((PyFloatObject *)right_o)->ob_fval = _dres;                     \
+    } while (0)
+
 // Inplace float true division. Sets _divop_err to 1 on zero division.
 // Caller must check _divop_err and call ERROR_NO_POP() if set.
 #define FLOAT_INPLACE_DIVOP(left, right, TARGET)                         \
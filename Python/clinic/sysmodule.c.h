@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(sys_addaudithook__doc__,
@@ -1239,6 +1240,36 @@ sys__debugmallocstats(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__debugmallocstats_impl(module);
 }
 
+PyDoc_STRVAR(sys__release_memory__doc__,
+"_release_memory($module, /)\n"
+"--\n"
+"\n"
+"Return the free memory of the object allocator to the system.\n"
+"\n"
+"Return the number of bytes released.");
+
+#define SYS__RELEASE_MEMORY_METHODDEF    \
+    {"_release_memory", (PyCFunction)sys__release_memory, METH_NOARGS, sys__release_memory__doc__},
+
+static Py_ssize_t
+sys__release_memory_impl(PyObject *module);
+
+static PyObject *
+sys__release_memory(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = sys__release_memory_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys__clear_type_cache__doc__,
 "_clear_type_cache($module, /)\n"
 "--\n"
@@ -2048,6 +2079,190 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_jit_get_stats__doc__,
+"get_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dict of statistics about the executors of the current interpreter.");
+
+#define _JIT_GET_STATS_METHODDEF    \
+    {"get_stats", (PyCFunction)_jit_get_stats, METH_NOARGS, _jit_get_stats__doc__},
+
+static PyObject *
+_jit_get_stats_impl(PyObject *module);
+
+static PyObject *
+_jit_get_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _jit_get_stats_impl(module);
+}
+
+PyDoc_STRVAR(_jit_set_memory_limit__doc__,
+"set_memory_limit($module, limit, /)\n"
+"--\n"
+"\n"
+"Set the memory budget for executors of the current interpreter, in bytes.\n"
+"\n"
+"While the budget is exceeded, no new executors are created, and executors\n"
+"that have not run recently are evicted.  A limit of 0 means no limit.");
+
+#define _JIT_SET_MEMORY_LIMIT_METHODDEF    \
+    {"set_memory_limit", (PyCFunction)_jit_set_memory_limit, METH_O, _jit_set_memory_limit__doc__},
+
+static PyObject *
+_jit_set_memory_limit_impl(PyObject *module, Py_ssize_t limit);
+
+static PyObject *
+_jit_set_memory_limit(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t limit;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        limit = ival;
+    }
+    return_value = _jit_set_memory_limit_impl(module, limit);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_jit_start_sampling__doc__,
+"start_sampling($module, /, size=4096, period=1)\n"
+"--\n"
+"\n"
+"Start recording JIT events into a ring buffer of the given size.\n"
+"\n"
+"One in every *period* events is recorded.  Once the buffer is full, the\n"
+"oldest events are overwritten.  Restarting discards the previous samples.");
+
+#define _JIT_START_SAMPLING_METHODDEF    \
+    {"start_sampling", _PyCFunction_CAST(_jit_start_sampling), METH_FASTCALL|METH_KEYWORDS, _jit_start_sampling__doc__},
+
+static PyObject *
+_jit_start_sampling_impl(PyObject *module, Py_ssize_t size, int period);
+
+static PyObject *
+_jit_start_sampling(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(size), &_Py_ID(period), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"size", "period", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "start_sampling",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    Py_ssize_t size = 4096;
+    int period = 1;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[0]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(args[0]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            size = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    period = PyLong_AsInt(args[1]);
+    if (period == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = _jit_start_sampling_impl(module, size, period);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_jit_stop_sampling__doc__,
+"stop_sampling($module, /)\n"
+"--\n"
+"\n"
+"Stop recording JIT events and discard the recorded samples.");
+
+#define _JIT_STOP_SAMPLING_METHODDEF    \
+    {"stop_sampling", (PyCFunction)_jit_stop_sampling, METH_NOARGS, _jit_stop_sampling__doc__},
+
+static PyObject *
+_jit_stop_sampling_impl(PyObject *module);
+
+static PyObject *
+_jit_stop_sampling(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _jit_stop_sampling_impl(module);
+}
+
+PyDoc_STRVAR(_jit_get_samples__doc__,
+"get_samples($module, /)\n"
+"--\n"
+"\n"
+"Return the recorded JIT events, oldest first.\n"
+"\n"
+"Each event is a tuple (kind, code, offset, opname), where kind is one of\n"
+"\"enter\", \"exit\", \"compile\" or \"abort\", and offset is the byte offset of the\n"
+"instruction in code.  Returns an empty list if sampling is not active.");
+
+#define _JIT_GET_SAMPLES_METHODDEF    \
+    {"get_samples", (PyCFunction)_jit_get_samples, METH_NOARGS, _jit_get_samples__doc__},
+
+static PyObject *
+_jit_get_samples_impl(PyObject *module);
+
+static PyObject *
+_jit_get_samples(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _jit_get_samples_impl(module);
+}
+
 #ifndef SYS_GETWINDOWSVERSION_METHODDEF
     #define SYS_GETWINDOWSVERSION_METHODDEF
 #endif /* !defined(SYS_GETWINDOWSVERSION_METHODDEF) */
@@ -2087,4 +2302,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=fb4fe1af274124e0 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=df6c1d90b8e7b089 input=a9049054013a1b77]*/
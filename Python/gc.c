@@ -11,9 +11,11 @@
 #include "pycore_interpframe.h"   // _PyFrame_GetLocalsArray()
 #include "pycore_object.h"
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_object_stack.h"  // _PyObjectStack
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_tuple.h"         // _PyTuple_MaybeUntrack()
+#include "pycore_unicodeobject.h" // _PyUnicode_InternImmortal()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
 #include "pydtrace.h"
 
@@ -1750,6 +1752,102 @@ _PyGC_Unfreeze(PyInterpreterState *interp)
                   GEN_HEAD(gcstate, NUM_GENERATIONS-1));
 }
 
+/* Make op immortal.  Its reference count is never written again, so the
+ * memory page holding it stays shared with the child processes after fork().
+ */
+static void
+immortalize(PyInterpreterState *interp, PyObject *op)
+{
+    assert(!_Py_IsImmortal(op));
+    if (PyUnicode_Check(op)) {
+        // Only interned strings can be immortal.  If an equal string is
+        // already interned, op is left mortal.
+        if (PyUnicode_CheckExact(op)) {
+            Py_INCREF(op);
+            _PyUnicode_InternImmortal(interp, &op);
+        }
+        return;
+    }
+#ifdef Py_REF_DEBUG
+    /* The decrefs of immortal objects are not counted in the RefTotal. */
+    _Py_AddRefTotal(_PyThreadState_GET(), -Py_REFCNT(op));
+#endif
+    // Tracked objects stay in the permanent generation, where they are not
+    // looked at by collections.
+    _Py_SetImmortalUntracked(op);
+}
+
+/* A traversal callback for _PyGC_ImmortalizeFrozen(). */
+static int
+visit_immortalize(PyObject *op, void *arg)
+{
+    if (_Py_IsImmortal(op)) {
+        return 0;
+    }
+    if (_PyObject_IS_GC(op) && _PyObject_GC_IS_TRACKED(op)) {
+        // It is in the permanent generation and will be visited from there.
+        return 0;
+    }
+    immortalize(_PyInterpreterState_GET(), op);
+    if (!_Py_IsImmortal(op)) {
+        return 0;
+    }
+    return _PyObjectStack_Push((_PyObjectStack *)arg, op);
+}
+
+static int
+traverse_immortalize(PyObject *op, _PyObjectStack *stack)
+{
+    if (PyCode_Check(op)) {
+        // Code objects are not GC objects in the default build.
+        return visit_immortalize(((PyCodeObject *)op)->co_consts, stack);
+    }
+    if (PyDict_Check(op)) {
+        // dict_traverse() does not visit str keys.
+        Py_ssize_t pos = 0;
+        PyObject *key;
+        while (PyDict_Next(op, &pos, &key, NULL)) {
+            if (visit_immortalize(key, stack) < 0) {
+                return -1;
+            }
+        }
+    }
+    traverseproc traverse = Py_TYPE(op)->tp_traverse;
+    if (traverse == NULL) {
+        return 0;
+    }
+    return traverse(op, visit_immortalize, stack);
+}
+
+/* Make the objects of the permanent generation immortal, as well as the
+ * objects that they refer to.
+ */
+int
+_PyGC_ImmortalizeFrozen(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    PyGC_Head *permanent = &gcstate->permanent_generation.head;
+    _PyObjectStack stack = { NULL };
+    int err = 0;
+    for (PyGC_Head *gc = GC_NEXT(permanent); gc != permanent; gc = GC_NEXT(gc)) {
+        PyObject *op = FROM_GC(gc);
+        if (_Py_IsImmortal(op)) {
+            continue;
+        }
+        immortalize(interp, op);
+        do {
+            if (traverse_immortalize(op, &stack) < 0) {
+                PyErr_NoMemory();
+                err = -1;
+                goto done;
+            }
+        } while ((op = _PyObjectStack_Pop(&stack)) != NULL);
+    }
+done:
+    _PyObjectStack_Clear(&stack);
+    return err;
+}
+
 Py_ssize_t
 _PyGC_GetFreezeCount(PyInterpreterState *interp)
 {
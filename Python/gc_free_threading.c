@@ -9,8 +9,10 @@
 #include "pycore_initconfig.h"    // _PyStatus_NO_MEMORY()
 #include "pycore_interp.h"        // PyInterpreterState.gc
 #include "pycore_interpframe.h"   // _PyFrame_GetLocalsArray()
+#include "pycore_lock.h"          // _Py_yield()
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_tstate.h"        // _PyThreadStateImpl
 #include "pycore_tuple.h"         // _PyTuple_MaybeUntrack()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
@@ -30,6 +32,9 @@
 // include Python stacks as set of known roots
 #define GC_MARK_ALIVE_STACKS 1
 
+// use several threads for the "mark alive" pass on large heaps
+#define GC_ENABLE_PARALLEL_MARK_ALIVE 1
+
 
 #ifdef Py_GIL_DISABLED
 
@@ -1357,6 +1362,306 @@ gc_propagate_alive(gc_mark_args_t *args)
     }
 }
 
+#ifdef GC_ENABLE_PARALLEL_MARK_ALIVE
+
+// parallel marking ///////////////////////////////////////////
+
+// Only mark in parallel if the last collection found at least this many
+// live objects.  For smaller heaps, starting the threads costs more than
+// it saves.
+#define PARALLEL_MARK_MIN_OBJECTS 200000
+
+// Maximum number of threads, including the collecting thread.
+#define PARALLEL_MARK_MAX_WORKERS 16
+
+// Number of objects in a work packet.
+#define PACKET_SIZE 512
+
+// A worker gives half of its packet to idle workers if it holds at least
+// this many objects.
+#define PACKET_SHARE_MIN 32
+
+// Objects that are marked alive but not yet traversed are kept in packets.
+// Each worker uses its own packet as a stack.  When that packet fills up,
+// or when other workers are idle, the worker moves objects to a packet on
+// the shared list, from which workers take a packet once theirs is empty.
+typedef struct gc_packet {
+    struct gc_packet *next;
+    Py_ssize_t size;
+    PyObject *items[PACKET_SIZE];
+} gc_packet_t;
+
+typedef struct {
+    PyMutex mutex;
+    gc_packet_t *full;  // shared packets, protected by mutex
+    int num_workers;
+    int num_waiting;    // workers waiting for a shared packet
+    int done;           // set when all workers wait and no packet is left
+    int error;          // set when a worker ran out of memory
+} gc_par_mark_t;
+
+typedef struct {
+    gc_par_mark_t *par;
+    gc_packet_t *packet;
+    gc_packet_t *spare;
+    PyThread_handle_t handle;
+} gc_mark_worker_t;
+
+// Worker threads have no thread state: they only call tp_traverse, and use
+// the raw memory allocator.
+static gc_packet_t *
+gc_mark_worker_new_packet(gc_mark_worker_t *w)
+{
+    gc_packet_t *packet = w->spare;
+    if (packet != NULL) {
+        w->spare = NULL;
+    }
+    else {
+        packet = PyMem_RawMalloc(sizeof(gc_packet_t));
+        if (packet == NULL) {
+            _Py_atomic_store_int(&w->par->error, 1);
+            return NULL;
+        }
+    }
+    packet->size = 0;
+    return packet;
+}
+
+static void
+gc_mark_share_packet(gc_par_mark_t *par, gc_packet_t *packet)
+{
+    PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+    packet->next = par->full;
+    _Py_atomic_store_ptr(&par->full, packet);
+    PyMutex_Unlock(&par->mutex);
+}
+
+static int
+gc_mark_worker_push(gc_mark_worker_t *w, PyObject *op)
+{
+    gc_packet_t *packet = w->packet;
+    if (packet->size == PACKET_SIZE) {
+        gc_packet_t *empty = gc_mark_worker_new_packet(w);
+        if (empty == NULL) {
+            return -1;
+        }
+        gc_mark_share_packet(w->par, packet);
+        w->packet = packet = empty;
+    }
+    packet->items[packet->size++] = op;
+    return 0;
+}
+
+// Give the bottom half of the worker's packet to the idle workers.  Those
+// objects were found first, so they likely lead to more objects.
+static int
+gc_mark_worker_split(gc_mark_worker_t *w)
+{
+    gc_packet_t *packet = w->packet;
+    gc_packet_t *half = gc_mark_worker_new_packet(w);
+    if (half == NULL) {
+        return -1;
+    }
+    Py_ssize_t n = packet->size / 2;
+    memcpy(half->items, packet->items, n * sizeof(PyObject *));
+    memmove(packet->items, packet->items + n,
+            (packet->size - n) * sizeof(PyObject *));
+    half->size = n;
+    packet->size -= n;
+    gc_mark_share_packet(w->par, half);
+    return 0;
+}
+
+// Take a packet from the shared list, waiting for one if there is none.
+// Return 0 if there is no work left, or if another worker failed.
+static int
+gc_mark_worker_take(gc_mark_worker_t *w)
+{
+    gc_par_mark_t *par = w->par;
+    PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+    for (;;) {
+        gc_packet_t *packet = par->full;
+        if (packet != NULL) {
+            _Py_atomic_store_ptr(&par->full, packet->next);
+            PyMutex_Unlock(&par->mutex);
+            assert(w->packet->size == 0);
+            if (w->spare == NULL) {
+                w->spare = w->packet;
+            }
+            else {
+                PyMem_RawFree(w->packet);
+            }
+            w->packet = packet;
+            return 1;
+        }
+        if (par->error) {
+            break;
+        }
+        _Py_atomic_store_int(&par->num_waiting, par->num_waiting + 1);
+        if (par->num_waiting == par->num_workers) {
+            // Every other worker is waiting too: marking is complete.
+            _Py_atomic_store_int(&par->done, 1);
+            break;
+        }
+        PyMutex_Unlock(&par->mutex);
+        while (_Py_atomic_load_ptr_relaxed(&par->full) == NULL &&
+               !_Py_atomic_load_int_relaxed(&par->done) &&
+               !_Py_atomic_load_int_relaxed(&par->error))
+        {
+            _Py_yield();
+        }
+        PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+        if (par->done) {
+            break;
+        }
+        _Py_atomic_store_int(&par->num_waiting, par->num_waiting - 1);
+    }
+    PyMutex_Unlock(&par->mutex);
+    return 0;
+}
+
+static int
+gc_mark_visit_parallel(PyObject *op, void *arg)
+{
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if (!(bits & _PyGC_BITS_TRACKED) || (bits & _PyGC_BITS_ALIVE)) {
+        return 0;
+    }
+    // Another worker may reach the object at the same time.  Only the one
+    // that sets the alive bit traverses it.  Unlike the serial pass, this
+    // does not untrack tuples, which would write the bits non-atomically.
+    if (_Py_atomic_or_uint8(&op->ob_gc_bits, _PyGC_BITS_ALIVE)
+        & _PyGC_BITS_ALIVE)
+    {
+        return 0;
+    }
+    return gc_mark_worker_push((gc_mark_worker_t *)arg, op);
+}
+
+static void
+gc_mark_worker_run(gc_mark_worker_t *w)
+{
+    gc_par_mark_t *par = w->par;
+    do {
+        gc_packet_t *packet;
+        while ((packet = w->packet)->size > 0) {
+            if (packet->size >= PACKET_SHARE_MIN &&
+                _Py_atomic_load_int_relaxed(&par->num_waiting) > 0 &&
+                _Py_atomic_load_ptr_relaxed(&par->full) == NULL)
+            {
+                if (gc_mark_worker_split(w) < 0) {
+                    return;
+                }
+            }
+            PyObject *op = packet->items[--packet->size];
+            traverseproc traverse = Py_TYPE(op)->tp_traverse;
+            if (traverse(op, gc_mark_visit_parallel, w) < 0) {
+                return;
+            }
+        }
+    } while (gc_mark_worker_take(w));
+}
+
+static void
+gc_mark_worker_thread(void *arg)
+{
+    gc_mark_worker_run((gc_mark_worker_t *)arg);
+}
+
+// Return the number of threads to use for the "mark alive" pass.
+static int
+gc_mark_alive_workers(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    if (gcstate->mark_alive_workers > 0) {
+        return gcstate->mark_alive_workers;
+    }
+    if (gcstate->long_lived_total < PARALLEL_MARK_MIN_OBJECTS) {
+        return 1;
+    }
+    // The other threads of the interpreter are stopped: use as many
+    // threads as there are thread states, unless there are fewer CPUs
+    // (or -X cpu_count is lower).
+    int n = 0;
+    _Py_FOR_EACH_TSTATE_BEGIN(interp, p) {
+        n++;
+    }
+    _Py_FOR_EACH_TSTATE_END(interp);
+    long cpu_count = _PyInterpreterState_GetConfig(interp)->cpu_count;
+#if defined(HAVE_SYSCONF) && defined(_SC_NPROCESSORS_ONLN)
+    if (cpu_count <= 0) {
+        cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+#endif
+    if (cpu_count > 0 && n > cpu_count) {
+        n = (int)cpu_count;
+    }
+    return Py_MIN(n, PARALLEL_MARK_MAX_WORKERS);
+}
+
+// Like gc_propagate_alive(), but split the work between num_workers
+// threads, including the current one.  The objects on args->stack (the
+// roots) must already be marked alive.
+static int
+gc_propagate_alive_parallel(gc_mark_args_t *args, int num_workers)
+{
+    assert(!args->use_prefetch);
+    assert(num_workers > 1);
+    gc_par_mark_t par = { .num_workers = num_workers };
+    gc_mark_worker_t *workers = PyMem_RawCalloc(num_workers,
+                                                sizeof(gc_mark_worker_t));
+    if (workers == NULL) {
+        return -1;
+    }
+    int started = 1;
+    for (int i = 0; i < num_workers; i++) {
+        workers[i].par = &par;
+        workers[i].packet = gc_mark_worker_new_packet(&workers[i]);
+        if (workers[i].packet == NULL) {
+            goto done;
+        }
+    }
+    PyObject *op;
+    while ((op = _PyObjectStack_Pop(&args->stack)) != NULL) {
+        if (gc_mark_worker_push(&workers[0], op) < 0) {
+            _PyObjectStack_Clear(&args->stack);
+            goto done;
+        }
+    }
+
+    for (; started < num_workers; started++) {
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(gc_mark_worker_thread,
+                                           &workers[started], &ident,
+                                           &workers[started].handle) != 0)
+        {
+            // Carry on with the threads that did start.
+            PyMutex_LockFlags(&par.mutex, _Py_LOCK_DONT_DETACH);
+            par.num_workers = started;
+            PyMutex_Unlock(&par.mutex);
+            break;
+        }
+    }
+    gc_mark_worker_run(&workers[0]);
+    for (int i = 1; i < started; i++) {
+        PyThread_join_thread(workers[i].handle);
+    }
+
+done:
+    while (par.full != NULL) {
+        gc_packet_t *packet = par.full;
+        par.full = packet->next;
+        PyMem_RawFree(packet);
+    }
+    for (int i = 0; i < num_workers; i++) {
+        PyMem_RawFree(workers[i].packet);
+        PyMem_RawFree(workers[i].spare);
+    }
+    PyMem_RawFree(workers);
+    return par.error ? -1 : 0;
+}
+#endif // GC_ENABLE_PARALLEL_MARK_ALIVE
+
 // Using tp_traverse, mark everything reachable from known root objects
 // (which must be non-garbage) as alive (_PyGC_BITS_ALIVE is set).  In
 // most programs, this marks nearly all objects that are not actually
@@ -1390,6 +1695,13 @@ gc_mark_alive_from_roots(PyInterpreterState *interp,
     // On 64-bit platforms, the minimum object size is 32 bytes.  A 4MB L2 cache
     // would hold about 130k objects.
     mark_args.use_prefetch = interp->gc.long_lived_total > 200000;
+#ifdef GC_ENABLE_PARALLEL_MARK_ALIVE
+    int num_workers = gc_mark_alive_workers(interp);
+    if (num_workers > 1) {
+        // The roots are collected on the stack, then shared by the workers.
+        mark_args.use_prefetch = false;
+    }
+#endif
 
     #define MARK_ENQUEUE(op) \
         if (op != NULL ) { \
@@ -1421,7 +1733,17 @@ gc_mark_alive_from_roots(PyInterpreterState *interp,
     #undef MARK_ENQUEUE
 
     // Use tp_traverse to find everything reachable from roots.
-    if (gc_propagate_alive(&mark_args) < 0) {
+    int err;
+#ifdef GC_ENABLE_PARALLEL_MARK_ALIVE
+    if (num_workers > 1) {
+        err = gc_propagate_alive_parallel(&mark_args, num_workers);
+    }
+    else
+#endif
+    {
+        err = gc_propagate_alive(&mark_args);
+    }
+    if (err < 0) {
         gc_abort_mark_alive(interp, state, &mark_args);
         return -1;
     }
@@ -2494,6 +2816,110 @@ _PyGC_Unfreeze(PyInterpreterState *interp)
     _PyEval_StartTheWorld(interp);
 }
 
+// Make op immortal, if it can be done while other threads may hold
+// references to it.
+static void
+immortalize(PyObject *op)
+{
+    if (_Py_IsImmortal(op)) {
+        return;
+    }
+    if (_Py_REF_IS_QUEUED(op->ob_ref_shared)) {
+        // Its refcount will be merged by its owning thread.
+        return;
+    }
+    if (PyUnicode_Check(op) && PyUnicode_CHECK_INTERNED(op)) {
+        // Immortalizing an interned string requires the interned dict lock.
+        return;
+    }
+#ifdef Py_REF_DEBUG
+    _Py_AddRefTotal(_PyThreadState_GET(), -Py_REFCNT(op));
+#endif
+    // Frozen objects stay tracked, collections skip them.
+    _Py_SetImmortalUntracked(op);
+    if (_PyObject_IS_GC(op)) {
+        // No thread owns op anymore: let readers take the lock-free paths
+        // instead of locking op, which writes to it.
+        _PyObject_GC_SET_SHARED(op);
+    }
+}
+
+struct immortalize_args {
+    struct visitor_args base;
+    _PyObjectStack stack;
+};
+
+static int
+visit_immortalize(PyObject *op, void *arg)
+{
+    if (_Py_IsImmortal(op)) {
+        return 0;
+    }
+    if (_PyObject_IS_GC(op) && _PyObject_GC_IS_TRACKED(op)) {
+        // It is visited by the heap walk.
+        return 0;
+    }
+    immortalize(op);
+    if (!_Py_IsImmortal(op)) {
+        // immortalize() left it mortal.
+        return 0;
+    }
+    return _PyObjectStack_Push((_PyObjectStack *)arg, op);
+}
+
+static int
+traverse_immortalize(PyObject *op, _PyObjectStack *stack)
+{
+    if (PyDict_Check(op)) {
+        // dict_traverse() does not visit str keys.
+        Py_ssize_t pos = 0;
+        PyObject *key;
+        while (PyDict_Next(op, &pos, &key, NULL)) {
+            if (visit_immortalize(key, stack) < 0) {
+                return -1;
+            }
+        }
+    }
+    traverseproc traverse = Py_TYPE(op)->tp_traverse;
+    if (traverse == NULL) {
+        return 0;
+    }
+    return traverse(op, visit_immortalize, stack);
+}
+
+static bool
+visit_immortalize_frozen(const mi_heap_t *heap, const mi_heap_area_t *area,
+                         void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, true);
+    if (op == NULL || !gc_is_frozen(op)) {
+        return true;
+    }
+    struct immortalize_args *arg = (struct immortalize_args *)args;
+    immortalize(op);
+    do {
+        if (traverse_immortalize(op, &arg->stack) < 0) {
+            return false;
+        }
+    } while ((op = _PyObjectStack_Pop(&arg->stack)) != NULL);
+    return true;
+}
+
+int
+_PyGC_ImmortalizeFrozen(PyInterpreterState *interp)
+{
+    struct immortalize_args args = { 0 };
+    _PyEval_StopTheWorld(interp);
+    int err = gc_visit_heaps(interp, &visit_immortalize_frozen, &args.base);
+    _PyEval_StartTheWorld(interp);
+    _PyObjectStack_Clear(&args.stack);
+    if (err < 0) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
 struct count_frozen_args {
     struct visitor_args base;
     Py_ssize_t count;
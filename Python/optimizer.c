@@ -40,6 +40,32 @@
 
 #define _PyExecutorObject_CAST(op)  ((_PyExecutorObject *)(op))
 
+static bool
+executor_memory_exhausted(PyInterpreterState *interp)
+{
+    size_t limit = interp->opt_config.executor_memory_limit;
+    return limit != 0 && interp->executor_memory >= limit;
+}
+
+/* Remember where an evicted executor was, so that rebuilding it
+ * can be counted as a recompilation. */
+static inline size_t
+evicted_site_index(_Py_CODEUNIT *instr)
+{
+    return ((uintptr_t)instr / sizeof(_Py_CODEUNIT)) &
+           (_PY_EVICTED_EXECUTOR_SITES - 1);
+}
+
+static void
+record_evicted_site(PyInterpreterState *interp, _PyExecutorObject *executor)
+{
+    if (executor->vm_data.code != NULL) {
+        _Py_CODEUNIT *instr =
+            &_PyCode_CODE(executor->vm_data.code)[executor->vm_data.index];
+        interp->evicted_executor_sites[evicted_site_index(instr)] = instr;
+    }
+}
+
 #ifndef Py_GIL_DISABLED
 static bool
 has_space_for_executor(PyCodeObject *code, _Py_CODEUNIT *instr)
@@ -89,6 +115,16 @@ get_index_for_executor(PyCodeObject *code, _Py_CODEUNIT *instr)
     return size;
 }
 
+static void
+check_recompiled_site(PyInterpreterState *interp, _Py_CODEUNIT *instr)
+{
+    size_t index = evicted_site_index(instr);
+    if (interp->evicted_executor_sites[index] == instr) {
+        interp->evicted_executor_sites[index] = NULL;
+        interp->executors_recompiled++;
+    }
+}
+
 static void
 insert_executor(PyCodeObject *code, _Py_CODEUNIT *instr, int index, _PyExecutorObject *executor)
 {
@@ -121,6 +157,10 @@ uop_optimize(_PyInterpreterFrame *frame, PyThreadState *tstate,
              _PyExecutorObject **exec_ptr,
              bool progress_needed);
 
+static void
+record_sample(PyInterpreterState *interp, int kind, PyCodeObject *code,
+              _Py_CODEUNIT *instr);
+
 /* Returns 1 if optimized, 0 if not optimized, and -1 for an error.
  * If optimized, *executor_ptr contains a new reference to the executor
  */
@@ -147,6 +187,10 @@ _PyOptimizer_Optimize(
     assert(!interp->compiling);
     assert(_tstate->jit_tracer_state->initial_state.stack_depth >= 0);
 #ifndef Py_GIL_DISABLED
+#define SAMPLE(KIND) \
+    if (interp->jit_samples != NULL) { \
+        record_sample(interp, (KIND), code, start); \
+    }
     assert(_tstate->jit_tracer_state->initial_state.func != NULL);
     interp->compiling = true;
     // The first executor in a chain and the MAX_CHAIN_DEPTH'th executor *must*
@@ -160,12 +204,14 @@ _PyOptimizer_Optimize(
     _Py_CODEUNIT *start = _tstate->jit_tracer_state->initial_state.start_instr;
     if (progress_needed && !has_space_for_executor(code, start)) {
         interp->compiling = false;
+        SAMPLE(_PyJitSample_ABORT);
         return 0;
     }
     _PyExecutorObject *executor;
     int err = uop_optimize(frame, tstate, &executor, progress_needed);
     if (err <= 0) {
         interp->compiling = false;
+        SAMPLE(_PyJitSample_ABORT);
         return err;
     }
     assert(executor != NULL);
@@ -180,9 +226,11 @@ _PyOptimizer_Optimize(
              * but there is not much we can do about that here. */
             Py_DECREF(executor);
             interp->compiling = false;
+            SAMPLE(_PyJitSample_ABORT);
             return 0;
         }
         insert_executor(code, start, index, executor);
+        check_recompiled_site(interp, start);
     }
     executor->vm_data.chain_depth = chain_depth;
     assert(executor->vm_data.valid);
@@ -196,7 +244,9 @@ _PyOptimizer_Optimize(
         Py_DECREF(executor);
     }
     interp->compiling = false;
+    SAMPLE(_PyJitSample_COMPILE);
     return 1;
+#undef SAMPLE
 #else
     return 0;
 #endif
@@ -1128,6 +1178,16 @@ _PyJit_TryInitializeTracing(
     if (tracer->is_tracing) {
         return 0;
     }
+    // Don't trace while over the memory budget. Count the attempt as if it
+    // created an executor instead, so that cold executors are swept at the
+    // usual rate: sweeping on every attempt would evict executors that just
+    // haven't run since the previous attempt.
+    if (executor_memory_exhausted(tstate->interp)) {
+        if (--tstate->interp->executor_creation_counter == 0) {
+            _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+        }
+        return 0;
+    }
     if (oparg > 0xFFFF) {
         return 0;
     }
@@ -1335,10 +1395,17 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
     int32_t current_error_target = -1;
     int32_t current_popped = -1;
     int32_t current_exit_op = -1;
+    /* _JUMP_TO_TOP jumps to just after _START_EXECUTOR, unless the
+     * optimizer peeled the first iteration of the loop */
+    int32_t loop_head = 1;
     /* Leaving in NOPs slows down the interpreter and messes up the stats */
     _PyUOpInstruction *copy_to = &buffer[0];
     for (int i = 0; i < length; i++) {
         _PyUOpInstruction *inst = &buffer[i];
+        if (_PyUop_Uncached[inst->opcode] == _LOOP_HEAD) {
+            loop_head = (int32_t)(copy_to - buffer);
+            continue;
+        }
         if (inst->opcode != _NOP) {
             if (copy_to != inst) {
                 *copy_to = *inst;
@@ -1399,8 +1466,9 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
         }
         if (base_opcode == _JUMP_TO_TOP) {
             assert(_PyUop_Uncached[buffer[0].opcode] == _START_EXECUTOR);
+            assert(loop_head < length);
             buffer[i].format = UOP_FORMAT_JUMP;
-            buffer[i].jump_target = 1;
+            buffer[i].jump_target = loop_head;
         }
     }
     return next_spare;
@@ -1419,6 +1487,8 @@ allocate_executor(int exit_count, int length)
     res->trace = (_PyUOpInstruction *)(res->exits + exit_count);
     res->code_size = length;
     res->exit_count = exit_count;
+    res->jit_code = NULL;
+    res->jit_size = 0;
     res->jit_registration = NULL;
     return res;
 }
@@ -1570,6 +1640,7 @@ make_executor_from_uops(_PyThreadStateImpl *tstate, _PyUOpInstruction *buffer, i
         Py_DECREF(executor);
         return NULL;
     }
+    interp->executor_memory += executor->jit_size;
 #endif
     return executor;
 }
@@ -1594,6 +1665,9 @@ int effective_trace_length(_PyUOpInstruction *buffer, int length)
 }
 #endif
 
+/* The cost of a spill or reload, relative to the cost of moving one value
+ * between a register and the stack. Dispatching the extra uop dominates. */
+#define SPILL_OR_RELOAD_COST 4
 
 static int
 stack_allocate(_PyUOpInstruction *buffer, _PyUOpInstruction *output, int length)
@@ -1612,6 +1686,46 @@ stack_allocate(_PyUOpInstruction *buffer, _PyUOpInstruction *output, int length)
     else {
         assert(output + UOP_MAX_TRACE_LENGTH == buffer);
     }
+    /* Choose the number of cached registers on entry to each uop, so as to
+     * minimize spill and reload traffic over the whole trace.
+     * Going backwards, cost[d] is the cost of executing the rest of the
+     * trace with d values cached. Each uop may be entered at its current
+     * depth, after spilling to a lower depth, or after reloading to its
+     * lowest input depth, which are the only reloads known to be safe.
+     * Ties are broken in favor of the choice `best` would make. */
+    uint8_t input_depth[UOP_MAX_TRACE_LENGTH][MAX_CACHED_REGISTER + 1];
+    int cost[MAX_CACHED_REGISTER + 1] = { 0 };
+    for (int i = length - 1; i >= 0; i--) {
+        int uop = buffer[i].opcode;
+        if (uop == _NOP) {
+            continue;
+        }
+        const _PyUopCachingInfo *info = &_PyUop_Caching[uop];
+        int new_cost[MAX_CACHED_REGISTER + 1];
+        for (int depth = 0; depth <= MAX_CACHED_REGISTER; depth++) {
+            int best = info->best[depth];
+            int lowest = info->best[0];
+            int chosen = -1;
+            int chosen_cost = INT_MAX;
+            for (int d = 0; d <= MAX_CACHED_REGISTER; d++) {
+                if (info->entries[d].opcode <= 0 || (d > depth && d != lowest)) {
+                    continue;
+                }
+                int c = cost[info->entries[d].output];
+                if (d != depth) {
+                    c += SPILL_OR_RELOAD_COST + abs(d - depth);
+                }
+                if (c < chosen_cost || (c == chosen_cost && d == best)) {
+                    chosen = d;
+                    chosen_cost = c;
+                }
+            }
+            assert(chosen >= 0);
+            input_depth[i][depth] = (uint8_t)chosen;
+            new_cost[depth] = chosen_cost;
+        }
+        memcpy(cost, new_cost, sizeof(cost));
+    }
     int depth = 0;
     _PyUOpInstruction *write = output;
     for (int i = 0; i < length; i++) {
@@ -1619,7 +1733,7 @@ stack_allocate(_PyUOpInstruction *buffer, _PyUOpInstruction *output, int length)
         if (uop == _NOP) {
             continue;
         }
-        int new_depth = _PyUop_Caching[uop].best[depth];
+        int new_depth = input_depth[i][depth];
         if (new_depth != depth) {
             write->opcode = _PyUop_SpillsAndReloads[depth][new_depth];
             assert(write->opcode != 0);
@@ -1712,6 +1826,7 @@ uop_optimize(
 
     // Check executor coldness
     // It's okay if this ends up going negative.
+    tstate->interp->executors_created++;
     if (--tstate->interp->executor_creation_counter == 0) {
         _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
     }
@@ -1725,6 +1840,14 @@ uop_optimize(
  *        Executor management
  ****************************************/
 
+/* The memory used by an executor, including its machine code, if any */
+static size_t
+executor_memory_size(_PyExecutorObject *executor)
+{
+    return _PyObject_VAR_SIZE(Py_TYPE(executor), Py_SIZE(executor)) +
+           executor->jit_size;
+}
+
 static int
 link_executor(_PyExecutorObject *executor, const _PyBloomFilter *bloom)
 {
@@ -1752,6 +1875,7 @@ link_executor(_PyExecutorObject *executor, const _PyBloomFilter *bloom)
     interp->executor_blooms[idx] = *bloom;
     interp->executor_ptrs[idx] = executor;
     executor->vm_data.bloom_array_idx = (int32_t)idx;
+    interp->executor_memory += executor_memory_size(executor);
     return 0;
 }
 
@@ -1769,6 +1893,8 @@ unlink_executor(_PyExecutorObject *executor)
         interp->executor_ptrs[idx]->vm_data.bloom_array_idx = idx;
     }
     executor->vm_data.bloom_array_idx = -1;
+    assert(interp->executor_memory >= executor_memory_size(executor));
+    interp->executor_memory -= executor_memory_size(executor);
 }
 
 /* This must be called by optimizers before using the executor */
@@ -1984,6 +2110,10 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
     }
     for (Py_ssize_t i = 0; i < PyList_GET_SIZE(invalidate); i++) {
         PyObject *exec = PyList_GET_ITEM(invalidate, i);
+        if (((_PyExecutorObject *)exec)->vm_data.valid) {
+            record_evicted_site(interp, (_PyExecutorObject *)exec);
+            interp->executors_evicted++;
+        }
         executor_invalidate(exec);
     }
     Py_DECREF(invalidate);
@@ -1992,9 +2122,126 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
     PyErr_Clear();
     Py_XDECREF(invalidate);
     // If we're truly out of memory, wiping out everything is a fine fallback
+    interp->executors_evicted += interp->executor_count;
     _Py_Executors_InvalidateAll(interp, 0);
 }
 
+/*****************************************
+ *        Sampling
+ ****************************************/
+
+int
+_PyJit_StartSampling(PyInterpreterState *interp, Py_ssize_t size, int period)
+{
+    assert(size > 0 && period > 0);
+    _PyJitSample *samples = PyMem_Calloc(size, sizeof(_PyJitSample));
+    if (samples == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    _PyJit_StopSampling(interp);
+    interp->jit_samples = samples;
+    interp->jit_samples_size = size;
+    interp->jit_samples_count = 0;
+    interp->jit_samples_period = period;
+    interp->jit_samples_countdown = 0;
+    return 0;
+}
+
+void
+_PyJit_StopSampling(PyInterpreterState *interp)
+{
+    PyMem_Free(interp->jit_samples);
+    interp->jit_samples = NULL;
+    interp->jit_samples_size = 0;
+    interp->jit_samples_count = 0;
+}
+
+static void
+record_sample(PyInterpreterState *interp, int kind, PyCodeObject *code,
+              _Py_CODEUNIT *instr)
+{
+    if (interp->jit_samples_countdown > 0) {
+        interp->jit_samples_countdown--;
+        return;
+    }
+    interp->jit_samples_countdown = interp->jit_samples_period - 1;
+    size_t index = interp->jit_samples_count++ % interp->jit_samples_size;
+    _PyJitSample *sample = &interp->jit_samples[index];
+    sample->code = code;
+    sample->offset = (int32_t)(instr - _PyCode_CODE(code));
+    sample->kind = (uint8_t)kind;
+    // Report the instruction hidden behind ENTER_EXECUTOR or instrumentation
+    sample->opcode = _Py_GetBaseCodeUnit(code, sample->offset).op.code;
+}
+
+void
+_PyJit_Sample(PyThreadState *tstate, int kind, _PyInterpreterFrame *frame,
+              _Py_CODEUNIT *instr)
+{
+    PyInterpreterState *interp = tstate->interp;
+    if (interp->jit_samples == NULL ||
+        frame->owner >= FRAME_OWNED_BY_INTERPRETER)
+    {
+        return;
+    }
+    PyCodeObject *code = _PyFrame_GetCode(frame);
+    // Report offsets into co_code, even with thread-local bytecode
+    _Py_CODEUNIT *bytecode = _PyFrame_GetBytecode(frame);
+    record_sample(interp, kind, code,
+                  _PyCode_CODE(code) + (instr - bytecode));
+}
+
+/* Samples only borrow their code object */
+void
+_PyJit_SampleForgetCode(PyInterpreterState *interp, PyCodeObject *code)
+{
+    size_t count = Py_MIN(interp->jit_samples_count, interp->jit_samples_size);
+    for (size_t i = 0; i < count; i++) {
+        if (interp->jit_samples[i].code == code) {
+            interp->jit_samples[i].code = NULL;
+        }
+    }
+}
+
+static const char *const sample_kinds[] = {
+    [_PyJitSample_ENTER] = "enter",
+    [_PyJitSample_EXIT] = "exit",
+    [_PyJitSample_COMPILE] = "compile",
+    [_PyJitSample_ABORT] = "abort",
+};
+
+/* Return the samples as a list of (kind, code, offset, opname) tuples,
+ * oldest first. */
+PyObject *
+_PyJit_GetSamples(PyInterpreterState *interp)
+{
+    PyObject *result = PyList_New(0);
+    if (result == NULL || interp->jit_samples == NULL) {
+        return result;
+    }
+    size_t size = interp->jit_samples_size;
+    size_t count = interp->jit_samples_count;
+    size_t start = count > size ? count - size : 0;
+    for (size_t i = start; i < count; i++) {
+        _PyJitSample *sample = &interp->jit_samples[i % size];
+        if (sample->code == NULL) {
+            continue;
+        }
+        PyObject *item = Py_BuildValue(
+            "sOis", sample_kinds[sample->kind], sample->code,
+            (int)sample->offset * (int)sizeof(_Py_CODEUNIT),
+            _PyOpcode_OpName[sample->opcode]);
+        if (item == NULL || PyList_Append(result, item) < 0) {
+            Py_XDECREF(item);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+    return result;
+}
+
 #include "record_functions.c.h"
 
 static int
@@ -403,6 +403,140 @@ eliminate_pop_guard(_PyUOpInstruction *this_instr, JitOptContext *ctx, bool exit
     }
 }
 
+/* Returns the inplace uop for a float/compact int BINARY_OP_EXTEND, or 0
+ * if neither operand is a uniquely referenced float. */
+static int
+float_int_inplace_op(int oparg, JitOptRef left, JitOptRef right)
+{
+    int lhs_float = PyJitRef_IsUnique(left) &&
+        sym_matches_type(left, &PyFloat_Type) && sym_is_compact_int(right);
+    int rhs_float = PyJitRef_IsUnique(right) &&
+        sym_matches_type(right, &PyFloat_Type) && sym_is_compact_int(left);
+    if (!lhs_float && !rhs_float) {
+        return 0;
+    }
+    switch (oparg) {
+        case NB_ADD:
+        case NB_INPLACE_ADD:
+            return lhs_float ? _BINARY_OP_ADD_FLOAT_INT_INPLACE
+                             : _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT;
+        case NB_SUBTRACT:
+        case NB_INPLACE_SUBTRACT:
+            return lhs_float ? _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE
+                             : _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT;
+        case NB_MULTIPLY:
+        case NB_INPLACE_MULTIPLY:
+            return lhs_float ? _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE
+                             : _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT;
+        default:
+            return 0;
+    }
+}
+
+/* Loads that push a single item and can't escape */
+static bool
+is_tuple_item_load(int opcode)
+{
+    switch (opcode) {
+        case _LOAD_FAST:
+        case _LOAD_FAST_BORROW:
+        case _LOAD_CONST:
+        case _LOAD_CONST_INLINE:
+        case _LOAD_CONST_INLINE_BORROW:
+        case _LOAD_SMALL_INT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Returns the previous uop before op, skipping the ones that push nothing,
+ * if it is an item load. */
+static _PyUOpInstruction *
+skip_back_to_item_load(JitOptContext *ctx, _PyUOpInstruction *op)
+{
+    do {
+        if (op == ctx->out_buffer.start) {
+            return NULL;
+        }
+        op--;
+    } while (op->opcode == _NOP || op->opcode == _SET_IP ||
+             op->opcode == _CHECK_VALIDITY);
+    return is_tuple_item_load(op->opcode) ? op : NULL;
+}
+
+/* Scalar replacement of a tuple that is unpacked right after it is built,
+ * as in `a, b, c, d = b, c, d, a` (the compiler only rewrites this for up
+ * to three items). If the _BUILD_TUPLE of the unpacked tuple is the last
+ * uop emitted, apart from the _SET_IP and _CHECK_VALIDITY of the unpacking
+ * instruction, nothing can observe the tuple while it exists, so the pair
+ * is equivalent to reversing the top n stack items. _BUILD_TUPLE does not
+ * escape, so that _CHECK_VALIDITY is redundant and is removed too: the
+ * trace must not exit while the items are on the stack instead of the
+ * tuple.
+ * _BUILD_TUPLE also turns borrowed references into owned ones, which the
+ * unpacked items are then stored as. So each item must be pushed by one of
+ * the loads right before _BUILD_TUPLE, and loads of locals are changed to
+ * take a new reference. Returns true if the tuple was eliminated. */
+static bool
+eliminate_build_tuple(JitOptContext *ctx, _PyUOpInstruction *this_instr,
+                      JitOptRef seq, int n)
+{
+    if (!PyJitRef_IsUnique(seq) || sym_tuple_length(seq) != n) {
+        return false;
+    }
+    assert(!(_PyUop_Flags[_BUILD_TUPLE] & HAS_ESCAPES_FLAG));
+    _PyUOpInstruction *prev = ctx->out_buffer.next;
+    while (prev > ctx->out_buffer.start &&
+           (prev[-1].opcode == _NOP || prev[-1].opcode == _SET_IP ||
+            prev[-1].opcode == _CHECK_VALIDITY))
+    {
+        prev--;
+    }
+    if (prev == ctx->out_buffer.start) {
+        return false;
+    }
+    prev--;
+    if (prev->opcode != _BUILD_TUPLE || prev->oparg != n) {
+        return false;
+    }
+    _PyUOpInstruction *load = prev;
+    for (int i = 0; i < n; i++) {
+        load = skip_back_to_item_load(ctx, load);
+        if (load == NULL) {
+            return false;
+        }
+    }
+    load = prev;
+    for (int i = 0; i < n; i++) {
+        load = skip_back_to_item_load(ctx, load);
+        if (load->opcode == _LOAD_FAST_BORROW) {
+            load->opcode = _LOAD_FAST;
+        }
+    }
+    for (_PyUOpInstruction *op = prev; op < ctx->out_buffer.next; op++) {
+        if (op->opcode != _SET_IP) {
+            REPLACE_OP(op, _NOP, 0, 0);
+        }
+    }
+    // Swap the items at depths i and n + 1 - i using only swaps with the top
+    for (int i = 1; i <= n / 2; i++) {
+        int j = n + 1 - i;
+        if (i == 1) {
+            ADD_OP(_SWAP, j, 0);
+        }
+        else {
+            ADD_OP(_SWAP, i, 0);
+            ADD_OP(_SWAP, j, 0);
+            ADD_OP(_SWAP, i, 0);
+        }
+    }
+    if (n < 2) {
+        ADD_OP(_NOP, 0, 0);
+    }
+    return true;
+}
+
 static JitOptRef
 lookup_attr(JitOptContext *ctx, _PyBloomFilter *dependencies, _PyUOpInstruction *this_instr,
             PyTypeObject *type, PyObject *name,
@@ -570,6 +704,135 @@ _Py_opt_assert_within_stack_bounds(
 #define ASSERT_WITHIN_STACK_BOUNDS(F, L) (void)0
 #endif
 
+/* Loop peeling
+ *
+ * A trace that ends in _JUMP_TO_TOP is a loop, and the guards in its body
+ * are executed on every iteration, including those that check values that
+ * do not change from one iteration to the next. To only check those once,
+ * the body is optimized a second time, starting from what is known about
+ * the locals and the stack at the end of the first iteration. _JUMP_TO_TOP
+ * then jumps back to the start of the second copy (marked by _LOOP_HEAD)
+ * rather than to the start of the trace, so the first copy runs once,
+ * as a pre-header.
+ *
+ * This is only valid if what the second copy assumes at its start still
+ * holds when it jumps back to its start, which is checked at the end of the
+ * second copy. If it doesn't, or if the second copy cannot be optimized to
+ * the end, it is discarded and the loop is left as it was. */
+
+/* Peeling doubles the length of the loop, so keep it to short loops */
+#define MAX_PEELED_LOOP_LENGTH (UOP_MAX_TRACE_LENGTH / 8)
+#define MAX_PEELED_LOOP_REFS 64
+
+/* The class of an instance of a mutable type can be changed by assigning
+ * to its __class__, so the type of a value that is not reloaded in the
+ * loop is only known on the next iteration if it is an immutable type. */
+static bool
+is_loop_invariant_type(PyTypeObject *type)
+{
+    return _PyType_HasFeature(type, Py_TPFLAGS_IMMUTABLETYPE) &&
+           !PyType_IsSubtype(type, &PyModule_Type);
+}
+
+/* Returns a new symbol for the facts about ref that are cheap to check
+ * at the end of the loop: whether it is NULL, its value, or its type. */
+static JitOptRef
+loop_head_ref(JitOptContext *ctx, JitOptRef ref, _PyBloomFilter *dependencies)
+{
+    if (sym_is_null(ref)) {
+        return sym_new_null(ctx);
+    }
+    PyTypeObject *type = sym_get_type(ref);
+    if (type == NULL || !is_loop_invariant_type(type)) {
+        return sym_is_not_null(ref) ? sym_new_not_null(ctx) : sym_new_unknown(ctx);
+    }
+    if (sym_is_const(ctx, ref)) {
+        return sym_new_const(ctx, sym_get_const(ctx, ref));
+    }
+    if (sym_is_compact_int(ref)) {
+        return sym_new_compact_int(ctx);
+    }
+    JitOptRef res = sym_new_type(ctx, type);
+    unsigned int version = sym_get_type_version(ref);
+    if (version != 0 && type->tp_version_tag == version) {
+        sym_set_type_version(res, version);
+        watch_type(type, dependencies);
+    }
+    return res;
+}
+
+/* Returns true if everything that is known about head is known about ref */
+static bool
+loop_head_holds(JitOptContext *ctx, JitOptRef head, JitOptRef ref)
+{
+    if (sym_is_null(head)) {
+        return sym_is_null(ref);
+    }
+    if (sym_is_const(ctx, head)) {
+        return sym_get_const(ctx, head) == sym_get_const(ctx, ref);
+    }
+    if (sym_is_compact_int(head) && !sym_is_compact_int(ref)) {
+        return false;
+    }
+    PyTypeObject *type = sym_get_type(head);
+    if (type != NULL && !sym_matches_type(ref, type)) {
+        return false;
+    }
+    unsigned int version = sym_get_type_version(head);
+    if (version != 0 && !sym_matches_type_version(ref, version)) {
+        return false;
+    }
+    return !sym_is_not_null(head) || sym_is_not_null(ref);
+}
+
+/* Replaces the locals and stack of the current frame with the symbols the
+ * peeled copy of the loop starts from, saving a copy of them in loop_head.
+ * Returns false if the loop cannot be peeled. */
+static bool
+start_peeled_loop(JitOptContext *ctx, JitOptRef *stack_pointer,
+                  JitOptRef *loop_head, _PyBloomFilter *dependencies)
+{
+    _Py_UOpsAbstractFrame *frame = ctx->frame;
+    int stack_level = (int)(stack_pointer - frame->stack);
+    if (ctx->curr_frame_depth != 1 ||
+        frame->locals_len + stack_level > MAX_PEELED_LOOP_REFS)
+    {
+        return false;
+    }
+    for (int i = 0; i < frame->locals_len; i++) {
+        loop_head[i] = loop_head_ref(ctx, frame->locals[i], dependencies);
+        frame->locals[i] = loop_head_ref(ctx, loop_head[i], dependencies);
+    }
+    loop_head += frame->locals_len;
+    for (int i = 0; i < stack_level; i++) {
+        loop_head[i] = loop_head_ref(ctx, frame->stack[i], dependencies);
+        frame->stack[i] = loop_head_ref(ctx, loop_head[i], dependencies);
+    }
+    return !ctx->done;
+}
+
+/* Returns true if the state at the end of the peeled copy of the loop
+ * satisfies what was assumed at its start */
+static bool
+peeled_loop_closes(JitOptContext *ctx, JitOptRef *stack_pointer,
+                   JitOptRef *loop_head)
+{
+    _Py_UOpsAbstractFrame *frame = ctx->frame;
+    assert(ctx->curr_frame_depth == 1);
+    for (int i = 0; i < frame->locals_len; i++) {
+        if (!loop_head_holds(ctx, loop_head[i], frame->locals[i])) {
+            return false;
+        }
+    }
+    loop_head += frame->locals_len;
+    for (int i = 0; frame->stack + i < stack_pointer; i++) {
+        if (!loop_head_holds(ctx, loop_head[i], frame->stack[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /* >0 (length) for success, 0 for not ready, clears all possible errors. */
 static int
 optimize_uops(
@@ -608,8 +871,37 @@ optimize_uops(
     _PyUOpInstruction *this_instr = NULL;
     JitOptRef *stack_pointer = ctx->frame->stack_pointer;
 
+    // Where the peeled copy of the loop starts in the output, or -1
+    int loop_head_index = -1;
+    _PyUOpInstruction *loop_back_edge = NULL;
+    JitOptRef loop_head[MAX_PEELED_LOOP_REFS];
+    // The optimizer modifies the trace in place, so the peeled copy of the
+    // loop is optimized from a copy of it, kept at the end of the output.
+    _PyUOpInstruction *loop_trace = NULL;
+    int loop_len = 0;
+    if (trace_len <= MAX_PEELED_LOOP_LENGTH) {
+        while (loop_len < trace_len && !is_terminator_uop(&trace[loop_len])) {
+            loop_len++;
+        }
+        if (loop_len < trace_len && trace[loop_len].opcode == _JUMP_TO_TOP) {
+            loop_len++;
+            loop_trace = ctx->out_buffer.end - loop_len;
+            memcpy(loop_trace, trace, loop_len * sizeof(_PyUOpInstruction));
+            ctx->out_buffer.end = loop_trace;
+        }
+    }
+
     for (int i = 0; i < trace_len; i++) {
         this_instr = &trace[i];
+        if (ctx->done && loop_head_index >= 0) {
+            // The peeled copy of the loop could not be optimized to
+            // the end, so discard it.
+            DPRINTF(2, "Discarding peeled loop\n");
+            ctx->out_buffer.next = ctx->out_buffer.start + loop_head_index;
+            *(ctx->out_buffer.next++) = *loop_back_edge;
+            ctx->contradiction = false;
+            break;
+        }
         if (ctx->done) {
             // Don't do any more optimization, but
             // we still need to reach a terminator for corrctness.
@@ -629,6 +921,32 @@ optimize_uops(
 
         DUMP_UOP(ctx, "abs", (int)(this_instr - trace), this_instr, stack_pointer);
 
+        if (opcode == _JUMP_TO_TOP && !CURRENT_FRAME_IS_INIT_SHIM()) {
+            if (loop_back_edge == NULL) {
+                loop_back_edge = this_instr;
+                if (loop_trace != NULL &&
+                    start_peeled_loop(ctx, stack_pointer, loop_head,
+                                      dependencies)) {
+                    DPRINTF(2, "Peeling loop\n");
+                    loop_head_index = uop_buffer_length(&ctx->out_buffer);
+                    ADD_OP(_LOOP_HEAD, 0, 0);
+                    // Start again from the _MAKE_WARM
+                    trace = loop_trace;
+                    trace_len = loop_len;
+                    assert(trace[1].opcode == _MAKE_WARM);
+                    i = 0;
+                    continue;
+                }
+            }
+            else if (loop_head_index >= 0) {
+                if (!peeled_loop_closes(ctx, stack_pointer, loop_head)) {
+                    DPRINTF(2, "Peeled loop does not close, discarding it\n");
+                    ctx->out_buffer.next = ctx->out_buffer.start + loop_head_index;
+                }
+                loop_head_index = -1;
+            }
+        }
+
         _PyUOpInstruction *out_ptr = ctx->out_buffer.next;
 
         switch (opcode) {
@@ -643,6 +961,12 @@ optimize_uops(
         if (ctx->out_buffer.next == out_ptr) {
             *(ctx->out_buffer.next++) = *this_instr;
         }
+        if (loop_head_index >= 0 &&
+            (_PyUop_Flags[opcode] & HAS_RECORDS_VALUE_FLAG))
+        {
+            // The first copy owns the recorded value
+            ctx->out_buffer.next = out_ptr;
+        }
         assert(ctx->frame != NULL);
         DUMP_UOPS(ctx, "out", out_ptr, stack_pointer);
         if (!CURRENT_FRAME_IS_INIT_SHIM() && !ctx->done) {
@@ -735,6 +1059,11 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
             case _START_EXECUTOR:
                 may_have_escaped = false;
                 break;
+            case _LOOP_HEAD:
+                /* The loop may have escaped before jumping back here */
+                may_have_escaped = true;
+                last_set_ip = -1;
+                break;
             case _SET_IP:
                 buffer[pc].opcode = _NOP;
                 last_set_ip = pc;
@@ -797,6 +1126,96 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
     Py_UNREACHABLE();
 }
 
+static void
+finish_stack_space_group(_PyUOpInstruction *first_check, int64_t max_space)
+{
+    if (first_check != NULL) {
+        assert(first_check->opcode == _CHECK_STACK_SPACE_OPERAND);
+        assert(max_space > 0 && max_space <= INT32_MAX);
+        first_check->operand0 = (uint64_t)max_space;
+    }
+}
+
+static void
+combine_stack_space_checks(_PyUOpInstruction *buffer, int buffer_size)
+{
+    /* Replace the _CHECK_STACK_SPACE_OPERAND of each call in a group of
+     * nested and sequential calls with a single check, at the first call,
+     * for the largest amount of stack space used by the group.
+     *
+     * This is only valid while every frame pushed since the first check
+     * was allocated by the call it was checked for, so that all frames in
+     * the group live in the same data stack chunk. A _PUSH_FRAME without
+     * a preceding check (generators, _PY_FRAME_GENERAL, __init__ shims)
+     * or a return out of a frame pushed before the group was started
+     * ends the group. */
+    _PyUOpInstruction *first_check = NULL;
+    int64_t framesizes[MAX_ABSTRACT_FRAME_DEPTH];
+    int depth = 0;
+    int64_t pending = 0;
+    int64_t curr_space = 0;
+    int64_t max_space = 0;
+    for (int pc = 0; pc < buffer_size; pc++) {
+        _PyUOpInstruction *inst = &buffer[pc];
+        switch (inst->opcode) {
+            case _CHECK_STACK_SPACE_OPERAND:
+            {
+                int64_t framesize = (int64_t)inst->operand0;
+                assert(framesize > 0);
+                if (first_check != NULL &&
+                    curr_space + framesize <= INT32_MAX &&
+                    depth < MAX_ABSTRACT_FRAME_DEPTH)
+                {
+                    inst->opcode = _NOP;
+                }
+                else {
+                    finish_stack_space_group(first_check, max_space);
+                    first_check = inst;
+                    depth = 0;
+                    curr_space = max_space = 0;
+                }
+                pending = framesize;
+                if (curr_space + pending > max_space) {
+                    max_space = curr_space + pending;
+                }
+                break;
+            }
+            case _PUSH_FRAME:
+                if (pending == 0) {
+                    finish_stack_space_group(first_check, max_space);
+                    first_check = NULL;
+                    break;
+                }
+                assert(first_check != NULL);
+                assert(depth < MAX_ABSTRACT_FRAME_DEPTH);
+                framesizes[depth++] = pending;
+                curr_space += pending;
+                pending = 0;
+                break;
+            case _RETURN_VALUE:
+            case _RETURN_GENERATOR:
+                if (depth > 0) {
+                    curr_space -= framesizes[--depth];
+                    break;
+                }
+                finish_stack_space_group(first_check, max_space);
+                first_check = NULL;
+                break;
+            case _YIELD_VALUE:
+            case _LOOP_HEAD:
+            case _EXIT_TRACE:
+            case _JUMP_TO_TOP:
+            case _DYNAMIC_EXIT:
+            case _DEOPT:
+                finish_stack_space_group(first_check, max_space);
+                first_check = NULL;
+                pending = 0;
+                break;
+        }
+    }
+    finish_stack_space_group(first_check, max_space);
+}
+
 //  0 - failure, no error raised, just fall back to Tier 1
 // -1 - failure, and raise error
 //  > 0 - length of optimized trace
@@ -824,6 +1243,8 @@ _Py_uop_analyze_and_optimize(
     length = remove_unneeded_uops(output, length);
     assert(length > 0);
 
+    combine_stack_space_checks(output, length);
+
     OPT_STAT_INC(optimizer_successes);
     return length;
 }
@@ -478,9 +478,17 @@ dummy_func(void) {
     }
 
     op(_BINARY_OP_ADD_UNICODE, (left, right -- res, l, r)) {
-        res = sym_new_type(ctx, &PyUnicode_Type);
-        l = left;
+        if (PyJitRef_IsUnique(left)) {
+            ADD_OP(_BINARY_OP_ADD_UNICODE_INPLACE, 0, 0);
+            l = PyJitRef_Borrow(sym_new_null(ctx));
+        }
+        else {
+            l = left;
+        }
         r = right;
+        // Usually a new string; "" + s returns s itself, which
+        // _BINARY_OP_ADD_UNICODE_INPLACE checks at runtime.
+        res = PyJitRef_MakeUnique(sym_new_type(ctx, &PyUnicode_Type));
     }
 
     op(_GUARD_BINARY_OP_EXTEND_LHS, (descr/4, left, right -- left, right)) {
@@ -536,6 +544,21 @@ dummy_func(void) {
         }
         l = left;
         r = right;
+        // The guard has checked the operands, so a float result from a
+        // float and a compact int can be stored in a unique float operand.
+        if (d != NULL && d->result_type == &PyFloat_Type) {
+            int uop = float_int_inplace_op(oparg, left, right);
+            if (uop != 0) {
+                ADD_OP(uop, 0, 0);
+                if (sym_matches_type(left, &PyFloat_Type)) {
+                    l = PyJitRef_Borrow(sym_new_null(ctx));
+                }
+                else {
+                    r = PyJitRef_Borrow(sym_new_null(ctx));
+                }
+                res = PyJitRef_MakeUnique(sym_new_type(ctx, &PyFloat_Type));
+            }
+        }
     }
 
     op(_BINARY_OP_INPLACE_ADD_UNICODE, (left, right -- res)) {
@@ -1568,6 +1591,72 @@ dummy_func(void) {
         }
     }
 
+    op(_GUARD_CALLABLE_BUILTIN_CLASS_KW, (callable, unused, unused[oparg], unused -- callable, unused, unused[oparg], unused)) {
+        PyObject *callable_o = sym_get_const(ctx, callable);
+        if (callable_o && sym_matches_type(callable, &PyType_Type)) {
+            PyTypeObject *tp = (PyTypeObject *)callable_o;
+            if (tp->tp_vectorcall != NULL) {
+                ADD_OP(_NOP, 0, 0);
+            }
+        }
+        else {
+            sym_set_type(callable, &PyType_Type);
+        }
+    }
+
+    op(_CALL_KW_BUILTIN_CLASS, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+        callable = sym_new_not_null(ctx);
+    }
+
+    op(_GUARD_CALLABLE_BUILTIN_FAST_KW, (callable, unused, unused[oparg], unused -- callable, unused, unused[oparg], unused)) {
+        PyObject *callable_o = sym_get_const(ctx, callable);
+        if (callable_o && sym_matches_type(callable, &PyCFunction_Type)) {
+            if (PyCFunction_GET_FLAGS(callable_o) == (METH_FASTCALL | METH_KEYWORDS)) {
+                ADD_OP(_NOP, 0, 0);
+            }
+        }
+        else {
+            sym_set_type(callable, &PyCFunction_Type);
+        }
+    }
+
+    op(_CALL_KW_BUILTIN_FAST, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+        callable = sym_new_not_null(ctx);
+    }
+
+    op(_GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+        PyObject *callable_o = sym_get_const(ctx, callable);
+        PyObject *kwnames_o = sym_get_const(ctx, kwnames);
+        if (callable_o && sym_matches_type(callable, &PyMethodDescr_Type) &&
+            kwnames_o && PyTuple_CheckExact(kwnames_o) &&
+            (sym_is_not_null(self_or_null) || sym_is_null(self_or_null))) {
+            int total_args = oparg;
+            if (sym_is_not_null(self_or_null)) {
+                total_args++;
+            }
+            PyTypeObject *self_type = NULL;
+            if (sym_is_not_null(self_or_null)) {
+                self_type = sym_get_type(self_or_null);
+            }
+            else if (oparg > 0) {
+                self_type = sym_get_type(args[0]);
+            }
+            PyTypeObject *d_type = ((PyMethodDescrObject *)callable_o)->d_common.d_type;
+            if (total_args > PyTuple_GET_SIZE(kwnames_o) &&
+                ((PyMethodDescrObject *)callable_o)->d_method->ml_flags == (METH_FASTCALL|METH_KEYWORDS) &&
+                self_type == d_type) {
+                ADD_OP(_NOP, 0, 0);
+            }
+        }
+        else {
+            sym_set_type(callable, &PyMethodDescr_Type);
+        }
+    }
+
+    op(_CALL_KW_METHOD_DESCRIPTOR_FAST, (callable, self_or_null, args[oparg], kwnames -- callable, self_or_null, args[oparg], kwnames)) {
+        callable = sym_new_not_null(ctx);
+    }
+
     op(_PUSH_FRAME, (new_frame -- )) {
         SYNC_SP();
         if (!CURRENT_FRAME_IS_INIT_SHIM()) {
@@ -2107,7 +2196,7 @@ dummy_func(void) {
     }
 
     op(_BUILD_STRING, (pieces[oparg] -- str)) {
-        str = sym_new_type(ctx, &PyUnicode_Type);
+        str = PyJitRef_MakeUnique(sym_new_type(ctx, &PyUnicode_Type));
     }
 
     op(_BUILD_SET, (values[oparg] -- set)) {
@@ -2131,7 +2220,10 @@ dummy_func(void) {
     }
 
     op(_UNPACK_SEQUENCE_TWO_TUPLE, (seq -- val1, val0)) {
-        if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 2) {
+        if (eliminate_build_tuple(ctx, this_instr, seq, 2)) {
+            // The tuple is never built
+        }
+        else if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 2) {
             ADD_OP(_UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE, oparg, 0);
         }
         val0 = sym_tuple_getitem(ctx, seq, 0);
@@ -2139,7 +2231,10 @@ dummy_func(void) {
     }
 
     op(_UNPACK_SEQUENCE_TUPLE, (seq -- values[oparg])) {
-        if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 3) {
+        if (eliminate_build_tuple(ctx, this_instr, seq, oparg)) {
+            // The tuple is never built
+        }
+        else if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 3) {
             ADD_OP(_UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE, oparg, 0);
         }
         else if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == oparg) {
@@ -1158,6 +1158,102 @@
             break;
         }
 
+        case _BINARY_OP_ADD_FLOAT_INT_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_INT_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_INT_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_ADD_INT_FLOAT_INPLACE_RIGHT: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_INT_FLOAT_INPLACE_RIGHT: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_INT_FLOAT_INPLACE_RIGHT: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
         case _BINARY_OP_ADD_UNICODE: {
             JitOptRef right;
             JitOptRef left;
@@ -1166,9 +1262,31 @@
             JitOptRef r;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
-            res = sym_new_type(ctx, &PyUnicode_Type);
-            l = left;
+            if (PyJitRef_IsUnique(left)) {
+                ADD_OP(_BINARY_OP_ADD_UNICODE_INPLACE, 0, 0);
+                l = PyJitRef_Borrow(sym_new_null(ctx));
+            }
+            else {
+                l = left;
+            }
             r = right;
+            res = PyJitRef_MakeUnique(sym_new_type(ctx, &PyUnicode_Type));
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_ADD_UNICODE_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
             CHECK_STACK_BOUNDS(1);
             stack_pointer[-2] = res;
             stack_pointer[-1] = l;
@@ -1280,6 +1398,26 @@
             }
             l = left;
             r = right;
+            if (d != NULL && d->result_type == &PyFloat_Type) {
+                CHECK_STACK_BOUNDS(1);
+                stack_pointer[-2] = res;
+                stack_pointer[-1] = l;
+                stack_pointer[0] = r;
+                stack_pointer += 1;
+                ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+                int uop = float_int_inplace_op(oparg, left, right);
+                if (uop != 0) {
+                    ADD_OP(uop, 0, 0);
+                    if (sym_matches_type(left, &PyFloat_Type)) {
+                        l = PyJitRef_Borrow(sym_new_null(ctx));
+                    }
+                    else {
+                        r = PyJitRef_Borrow(sym_new_null(ctx));
+                    }
+                    res = PyJitRef_MakeUnique(sym_new_type(ctx, &PyFloat_Type));
+                }
+                stack_pointer += -1;
+            }
             CHECK_STACK_BOUNDS(1);
             stack_pointer[-2] = res;
             stack_pointer[-1] = l;
@@ -2048,7 +2186,9 @@
             JitOptRef val1;
             JitOptRef val0;
             seq = stack_pointer[-1];
-            if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 2) {
+            if (eliminate_build_tuple(ctx, this_instr, seq, 2)) {
+            }
+            else if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 2) {
                 ADD_OP(_UNPACK_SEQUENCE_UNIQUE_TWO_TUPLE, oparg, 0);
             }
             val0 = sym_tuple_getitem(ctx, seq, 0);
@@ -2095,7 +2235,9 @@
             JitOptRef *values;
             seq = stack_pointer[-1];
             values = &stack_pointer[-1];
-            if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 3) {
+            if (eliminate_build_tuple(ctx, this_instr, seq, oparg)) {
+            }
+            else if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == 3) {
                 ADD_OP(_UNPACK_SEQUENCE_UNIQUE_THREE_TUPLE, oparg, 0);
             }
             else if (PyJitRef_IsUnique(seq) && sym_tuple_length(seq) == oparg) {
@@ -2388,7 +2530,7 @@
 
         case _BUILD_STRING: {
             JitOptRef str;
-            str = sym_new_type(ctx, &PyUnicode_Type);
+            str = PyJitRef_MakeUnique(sym_new_type(ctx, &PyUnicode_Type));
             CHECK_STACK_BOUNDS(1 - oparg);
             stack_pointer[-oparg] = str;
             stack_pointer += 1 - oparg;
@@ -5149,6 +5291,99 @@
             break;
         }
 
+        case _GUARD_CALLABLE_BUILTIN_CLASS_KW: {
+            JitOptRef callable;
+            callable = stack_pointer[-3 - oparg];
+            PyObject *callable_o = sym_get_const(ctx, callable);
+            if (callable_o && sym_matches_type(callable, &PyType_Type)) {
+                PyTypeObject *tp = (PyTypeObject *)callable_o;
+                if (tp->tp_vectorcall != NULL) {
+                    ADD_OP(_NOP, 0, 0);
+                }
+            }
+            else {
+                sym_set_type(callable, &PyType_Type);
+            }
+            break;
+        }
+
+        case _CALL_KW_BUILTIN_CLASS: {
+            JitOptRef callable;
+            callable = stack_pointer[-3 - oparg];
+            callable = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = callable;
+            break;
+        }
+
+        case _GUARD_CALLABLE_BUILTIN_FAST_KW: {
+            JitOptRef callable;
+            callable = stack_pointer[-3 - oparg];
+            PyObject *callable_o = sym_get_const(ctx, callable);
+            if (callable_o && sym_matches_type(callable, &PyCFunction_Type)) {
+                if (PyCFunction_GET_FLAGS(callable_o) == (METH_FASTCALL | METH_KEYWORDS)) {
+                    ADD_OP(_NOP, 0, 0);
+                }
+            }
+            else {
+                sym_set_type(callable, &PyCFunction_Type);
+            }
+            break;
+        }
+
+        case _CALL_KW_BUILTIN_FAST: {
+            JitOptRef callable;
+            callable = stack_pointer[-3 - oparg];
+            callable = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = callable;
+            break;
+        }
+
+        case _GUARD_CALLABLE_METHOD_DESCRIPTOR_FAST_KW: {
+            JitOptRef kwnames;
+            JitOptRef *args;
+            JitOptRef self_or_null;
+            JitOptRef callable;
+            kwnames = stack_pointer[-1];
+            args = &stack_pointer[-1 - oparg];
+            self_or_null = stack_pointer[-2 - oparg];
+            callable = stack_pointer[-3 - oparg];
+            PyObject *callable_o = sym_get_const(ctx, callable);
+            PyObject *kwnames_o = sym_get_const(ctx, kwnames);
+            if (callable_o && sym_matches_type(callable, &PyMethodDescr_Type) &&
+                kwnames_o && PyTuple_CheckExact(kwnames_o) &&
+                (sym_is_not_null(self_or_null) || sym_is_null(self_or_null))) {
+                int total_args = oparg;
+                if (sym_is_not_null(self_or_null)) {
+                    total_args++;
+                }
+                PyTypeObject *self_type = NULL;
+                if (sym_is_not_null(self_or_null)) {
+                    self_type = sym_get_type(self_or_null);
+                }
+                else if (oparg > 0) {
+                    self_type = sym_get_type(args[0]);
+                }
+                PyTypeObject *d_type = ((PyMethodDescrObject *)callable_o)->d_common.d_type;
+                if (total_args > PyTuple_GET_SIZE(kwnames_o) &&
+                    ((PyMethodDescrObject *)callable_o)->d_method->ml_flags == (METH_FASTCALL|METH_KEYWORDS) &&
+                    self_type == d_type) {
+                    ADD_OP(_NOP, 0, 0);
+                }
+            }
+            else {
+                sym_set_type(callable, &PyMethodDescr_Type);
+            }
+            break;
+        }
+
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST: {
+            JitOptRef callable;
+            callable = stack_pointer[-3 - oparg];
+            callable = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = callable;
+            break;
+        }
+
         case _MAKE_CALLARGS_A_TUPLE: {
             break;
         }
@@ -5558,6 +5793,10 @@
             break;
         }
 
+        case _LOOP_HEAD: {
+            break;
+        }
+
         case _SET_IP: {
             break;
         }
@@ -1907,6 +1907,7 @@ finalize_modules(PyThreadState *tstate)
     interp->executor_ptrs = NULL;
     interp->executor_count = 0;
     interp->executor_capacity = 0;
+    _PyJit_StopSampling(interp);
 #endif
 
     // Stop watching __builtin__ modifications
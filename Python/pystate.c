@@ -538,6 +538,21 @@ init_policy(uint16_t *target, const char *env_name, uint16_t default_value,
     }
 }
 
+static inline void
+init_size_policy(size_t *target, const char *env_name, size_t default_value)
+{
+    *target = default_value;
+    char *env = Py_GETENV(env_name);
+    if (env && '0' <= *env && *env <= '9') {
+        char *end;
+        errno = 0;
+        unsigned long long value = strtoull(env, &end, 10);
+        if (errno == 0 && *end == '\0' && value <= PY_SSIZE_T_MAX) {
+            *target = (size_t)value;
+        }
+    }
+}
+
 static PyStatus
 init_interpreter(PyInterpreterState *interp,
                  _PyRuntimeState *runtime, int64_t id,
@@ -599,6 +614,12 @@ init_interpreter(PyInterpreterState *interp,
     interp->executor_capacity = 0;
     interp->executor_deletion_list_head = NULL;
     interp->executor_creation_counter = JIT_CLEANUP_THRESHOLD;
+    interp->executor_memory = 0;
+    interp->executors_created = 0;
+    interp->executors_evicted = 0;
+    interp->executors_recompiled = 0;
+    memset(interp->evicted_executor_sites, 0,
+           sizeof(interp->evicted_executor_sites));
 
     // Initialize optimization configuration from environment variables
     // PYTHON_JIT_STRESS sets aggressive defaults for testing, but can be overridden
@@ -636,6 +657,10 @@ init_interpreter(PyInterpreterState *interp,
                 "PYTHON_JIT_FITNESS_INITIAL",
                 FITNESS_INITIAL, EXIT_QUALITY_CLOSE_LOOP, FITNESS_INITIAL);
 
+    // Executor memory budget, in bytes
+    init_size_policy(&interp->opt_config.executor_memory_limit,
+                     "PYTHON_JIT_MEMORY_LIMIT", 0);
+
     interp->opt_config.specialization_enabled = !is_env_enabled("PYTHON_SPECIALIZATION_OFF");
     interp->opt_config.uops_optimize_enabled = !is_env_disabled("PYTHON_UOPS_OPTIMIZE");
     if (interp != &runtime->_main_interpreter) {
@@ -194,6 +194,9 @@ const _PyOpcodeRecordEntry _PyOpcode_RecordEntries[256] = {
         [CALL_KW_BOUND_METHOD] = {1, {_RECORD_CALLABLE_KW_INDEX}},
         [CALL_KW] = {1, {_RECORD_CALLABLE_KW_INDEX}},
         [CALL_KW_NON_PY] = {1, {_RECORD_CALLABLE_KW_INDEX}},
+        [CALL_KW_BUILTIN_CLASS] = {1, {_RECORD_CALLABLE_KW_INDEX}},
+        [CALL_KW_BUILTIN_FAST] = {1, {_RECORD_CALLABLE_KW_INDEX}},
+        [CALL_KW_METHOD_DESCRIPTOR_FAST] = {1, {_RECORD_CALLABLE_KW_INDEX}},
         [CALL_FUNCTION_EX] = {1, {_RECORD_4OS_INDEX}},
         [CALL_EX_PY] = {1, {_RECORD_4OS_INDEX}},
         [CALL_EX_NON_PY_GENERAL] = {1, {_RECORD_4OS_INDEX}},
@@ -243,6 +246,9 @@ const _PyOpcodeRecordSlotMap _PyOpcode_RecordSlotMaps[256] = {
         [CALL_METHOD_DESCRIPTOR_NOARGS] = {1, 0, {0}},
         [CALL_KW_PY] = {1, 0, {0}},
         [CALL_KW_BOUND_METHOD] = {1, 0, {0}},
+        [CALL_KW_BUILTIN_CLASS] = {1, 0, {0}},
+        [CALL_KW_BUILTIN_FAST] = {1, 0, {0}},
+        [CALL_KW_METHOD_DESCRIPTOR_FAST] = {1, 0, {0}},
         [CALL_EX_PY] = {1, 0, {0}},
         [BINARY_OP] = {2, 2, {1, 0}},
 };
@@ -1917,6 +1917,30 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
             fail = -1;
         }
     }
+    else if (PyCFunction_CheckExact(callable) &&
+             PyCFunction_GET_FUNCTION(callable) != NULL &&
+             (PyCFunction_GET_FLAGS(callable) &
+              (METH_VARARGS | METH_FASTCALL | METH_NOARGS | METH_O |
+               METH_KEYWORDS | METH_METHOD)) == (METH_FASTCALL | METH_KEYWORDS))
+    {
+        specialize(instr, CALL_KW_BUILTIN_FAST);
+        fail = 0;
+    }
+    else if (Py_IS_TYPE(callable, &PyMethodDescr_Type) &&
+             (((PyMethodDescrObject *)callable)->d_method->ml_flags &
+              (METH_VARARGS | METH_FASTCALL | METH_NOARGS | METH_O |
+               METH_KEYWORDS | METH_METHOD)) == (METH_FASTCALL | METH_KEYWORDS))
+    {
+        specialize(instr, CALL_KW_METHOD_DESCRIPTOR_FAST);
+        fail = 0;
+    }
+    else if (PyType_Check(callable) &&
+             (((PyTypeObject *)callable)->tp_flags & Py_TPFLAGS_IMMUTABLETYPE) &&
+             ((PyTypeObject *)callable)->tp_vectorcall != NULL)
+    {
+        specialize(instr, CALL_KW_BUILTIN_CLASS);
+        fail = 0;
+    }
     else {
         specialize(instr, CALL_KW_NON_PY);
         fail = 0;
@@ -19,12 +19,14 @@ Data members:
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_SetAsyncGenFinalizer()
 #include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_freelist.h"      // _PyObject_ClearFreeLists()
 #include "pycore_import.h"        // _PyImport_SetDLOpenFlags()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_interpframe.h"   // _PyFrame_GetFirstComplete()
 #include "pycore_long.h"          // _PY_LONG_MAX_STR_DIGITS_THRESHOLD
 #include "pycore_modsupport.h"    // _PyModule_CreateInitialized()
 #include "pycore_namespace.h"     // _PyNamespace_New()
+#include "pycore_obmalloc.h"      // _PyObject_ReleaseFreeMemory()
 #include "pycore_object.h"        // _PyObject_DebugTypeStats()
 #include "pycore_optimizer.h"     // _PyDumpExecutors()
 #include "pycore_pathconfig.h"    // _PyPathConfig_ComputeSysPath0()
@@ -2173,6 +2175,27 @@ sys__debugmallocstats_impl(PyObject *module)
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+sys._release_memory -> Py_ssize_t
+
+Return the free memory of the object allocator to the system.
+
+Return the number of bytes released.
+[clinic start generated code]*/
+
+static Py_ssize_t
+sys__release_memory_impl(PyObject *module)
+/*[clinic end generated code: output=a2fe9bcfbe5cbb04 input=87db25c3391128be]*/
+{
+    // Free the memory kept by the freelists first.
+    _PyObject_ClearFreeLists(_Py_freelists_GET(), 0);
+#ifdef WITH_PYMALLOC
+    return (Py_ssize_t)_PyObject_ReleaseFreeMemory();
+#else
+    return 0;
+#endif
+}
+
 #ifdef Py_TRACE_REFS
 /* Defined in objects.c because it uses static globals in that file */
 extern PyObject *_Py_GetObjects(PyObject *, PyObject *);
@@ -2921,6 +2944,7 @@ static PyMethodDef sys_methods[] = {
     SYS_GETTRACE_METHODDEF
     SYS_CALL_TRACING_METHODDEF
     SYS__DEBUGMALLOCSTATS_METHODDEF
+    SYS__RELEASE_MEMORY_METHODDEF
     SYS_SET_COROUTINE_ORIGIN_TRACKING_DEPTH_METHODDEF
     SYS_GET_COROUTINE_ORIGIN_TRACKING_DEPTH_METHODDEF
     {"set_asyncgen_hooks", _PyCFunction_CAST(sys_set_asyncgen_hooks),
@@ -4256,10 +4280,141 @@ _jit_is_active_impl(PyObject *module)
     return _PyThreadState_GET()->current_executor != NULL;
 }
 
+/*[clinic input]
+_jit.get_stats
+
+Return a dict of statistics about the executors of the current interpreter.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_get_stats_impl(PyObject *module)
+/*[clinic end generated code: output=e026acb163af2069 input=b97c5191fb7b91c7]*/
+{
+    (void)module;
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return Py_BuildValue(
+        "{s:n,s:n,s:n,s:n,s:n,s:n}",
+        "executors", (Py_ssize_t)interp->executor_count,
+        "memory", (Py_ssize_t)interp->executor_memory,
+        "memory_limit", (Py_ssize_t)interp->opt_config.executor_memory_limit,
+        "created", (Py_ssize_t)interp->executors_created,
+        "evicted", (Py_ssize_t)interp->executors_evicted,
+        "recompiled", (Py_ssize_t)interp->executors_recompiled);
+}
+
+/*[clinic input]
+_jit.set_memory_limit
+
+    limit: Py_ssize_t
+    /
+
+Set the memory budget for executors of the current interpreter, in bytes.
+
+While the budget is exceeded, no new executors are created, and executors
+that have not run recently are evicted.  A limit of 0 means no limit.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_set_memory_limit_impl(PyObject *module, Py_ssize_t limit)
+/*[clinic end generated code: output=bfdbe4dee7ed7f21 input=bde36466e4c9ae1c]*/
+{
+    (void)module;
+    if (limit < 0) {
+        PyErr_SetString(PyExc_ValueError, "limit must be non-negative");
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    interp->opt_config.executor_memory_limit = (size_t)limit;
+#ifdef _Py_TIER2
+    if (limit != 0 && interp->executor_memory >= (size_t)limit) {
+        _Py_set_eval_breaker_bit(_PyThreadState_GET(),
+                                 _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+    }
+#endif
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_jit.start_sampling
+
+    size: Py_ssize_t = 4096
+    period: int = 1
+
+Start recording JIT events into a ring buffer of the given size.
+
+One in every *period* events is recorded.  Once the buffer is full, the
+oldest events are overwritten.  Restarting discards the previous samples.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_start_sampling_impl(PyObject *module, Py_ssize_t size, int period)
+/*[clinic end generated code: output=5c23cf3fff1b10be input=11f4ff556eb57160]*/
+{
+    (void)module;
+    if (size <= 0) {
+        PyErr_SetString(PyExc_ValueError, "size must be positive");
+        return NULL;
+    }
+    if (period <= 0) {
+        PyErr_SetString(PyExc_ValueError, "period must be positive");
+        return NULL;
+    }
+#ifdef _Py_TIER2
+    if (_PyJit_StartSampling(_PyInterpreterState_GET(), size, period) < 0) {
+        return NULL;
+    }
+#endif
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_jit.stop_sampling
+
+Stop recording JIT events and discard the recorded samples.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_stop_sampling_impl(PyObject *module)
+/*[clinic end generated code: output=42a66cb281c9cdf7 input=43ecfb4109bcec9a]*/
+{
+    (void)module;
+#ifdef _Py_TIER2
+    _PyJit_StopSampling(_PyInterpreterState_GET());
+#endif
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_jit.get_samples
+
+Return the recorded JIT events, oldest first.
+
+Each event is a tuple (kind, code, offset, opname), where kind is one of
+"enter", "exit", "compile" or "abort", and offset is the byte offset of the
+instruction in code.  Returns an empty list if sampling is not active.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_get_samples_impl(PyObject *module)
+/*[clinic end generated code: output=f813abf5816fe2c6 input=3f868fd0eb7c4a66]*/
+{
+    (void)module;
+#ifdef _Py_TIER2
+    return _PyJit_GetSamples(_PyInterpreterState_GET());
+#else
+    return PyList_New(0);
+#endif
+}
+
 static PyMethodDef _jit_methods[] = {
     _JIT_IS_AVAILABLE_METHODDEF
     _JIT_IS_ENABLED_METHODDEF
     _JIT_IS_ACTIVE_METHODDEF
+    _JIT_GET_STATS_METHODDEF
+    _JIT_SET_MEMORY_LIMIT_METHODDEF
+    _JIT_START_SAMPLING_METHODDEF
+    _JIT_STOP_SAMPLING_METHODDEF
+    _JIT_GET_SAMPLES_METHODDEF
     {NULL}
 };
 
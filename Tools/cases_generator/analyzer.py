@@ -1397,7 +1397,7 @@ def get_uop_cache_depths(uop: Uop) -> Iterator[tuple[int, int, int]]:
         for i in range(MAX_CACHED_REGISTER+1):
             yield i, 0, 0
         return
-    if uop.name in ("_START_EXECUTOR", "_JUMP_TO_TOP", "_COLD_EXIT"):
+    if uop.name in ("_START_EXECUTOR", "_JUMP_TO_TOP", "_LOOP_HEAD", "_COLD_EXIT"):
         yield 0, 0, 0
         return
     if uop.name == "_ERROR_POP_N":
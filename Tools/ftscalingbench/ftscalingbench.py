@@ -180,6 +180,38 @@ def create_dict():
             "key": "value",
         }
 
+shared_dict = {f"key{i}": i for i in range(100)}
+shared_dict_keys = list(shared_dict)
+
+@register_benchmark
+def shared_dict_read_mostly():
+    # A cache or registry shared by all threads: lookups, with an
+    # occasional overwrite of an existing key.
+    d = shared_dict
+    keys = shared_dict_keys
+    n = len(keys)
+    for i in range(1000 * WORK_SCALE):
+        key = keys[i % n]
+        if i % 100 == 0:
+            d[key] = i
+        else:
+            d[key]
+
+@register_benchmark
+def shared_dict_write_mostly():
+    # Overwrites and deletions of keys that the threads share, with reads
+    # in between.
+    d = shared_dict
+    keys = shared_dict_keys
+    n = len(keys)
+    for i in range(500 * WORK_SCALE):
+        key = keys[i % n]
+        d[key] = i
+        d.get(key)
+        if i % 10 == 0:
+            d.pop(key, None)
+            d[key] = i
+
 if hasattr(__builtins__, "frozendict"):
     @register_benchmark
     def create_frozendict():
@@ -0,0 +1,111 @@
+# Measure the pause time of full garbage collections against the number of
+# threads.
+#
+# Usage: python Tools/gcbench/gcbench.py [options] [threads]
+#
+# Options:
+#   --objects N    Number of live objects in the heap, in thousands
+#                  (default: 1000).  They are allocated evenly by the threads.
+#   --workers N    Number of threads marking objects in the free-threaded
+#                  build (default: 0 = one per thread, if the heap is large).
+#                  Requires _testinternalcapi.
+#   --repeat N     Number of collections timed for each thread count
+#                  (default: 10).
+#
+# How to interpret the results:
+#
+# The free-threaded build stops all threads during a collection.  Its "mark
+# alive" pass, which finds the objects reachable from the modules and the
+# thread stacks, runs on as many threads as there are (stopped) Python
+# threads, so the pause should get shorter as threads are added, up to the
+# number of CPUs.  The other passes still walk the heap on one thread.
+# The default build always collects on one thread.
+
+import argparse
+import gc
+import sys
+import threading
+import time
+
+
+class Node:
+    def __init__(self, i):
+        self.value = i
+        self.items = [i]
+
+
+def make_objects(n):
+    # Each Node is three GC objects: the instance, its dict and the list.
+    return [Node(i) for i in range(n // 3)]
+
+
+def parse_threads(value):
+    if '-' in value:
+        lo, hi = value.split('-', 1)
+        lo, hi = int(lo), int(hi)
+        return range(lo, hi + 1)
+    return range(int(value), int(value) + 1)
+
+
+def measure(num_threads, num_objects, repeat):
+    heaps = [None] * num_threads
+    ready = threading.Barrier(num_threads)
+    stop = threading.Event()
+
+    def worker(index):
+        heaps[index] = make_objects(num_objects // num_threads)
+        ready.wait()
+        stop.wait()
+
+    threads = [threading.Thread(target=worker, args=(i,))
+               for i in range(1, num_threads)]
+    for t in threads:
+        t.start()
+    heaps[0] = make_objects(num_objects // num_threads)
+    ready.wait()
+
+    # The first collection records the number of live objects.
+    gc.collect()
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        gc.collect()
+        times.append(time.perf_counter() - start)
+
+    stop.set()
+    for t in threads:
+        t.join()
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark GC pauses")
+    parser.add_argument("--objects", type=int, default=1000,
+                        help="live objects, in thousands")
+    parser.add_argument("--workers", type=int, default=0,
+                        help="marking threads (0 = one per thread)")
+    parser.add_argument("--repeat", type=int, default=10,
+                        help="collections per thread count")
+    parser.add_argument("threads", type=parse_threads, nargs='?',
+                        default=range(1, 9),
+                        help="Number of threads: N or MIN-MAX (default: 1-8)")
+    args = parser.parse_args()
+
+    if args.workers:
+        from _testinternalcapi import set_gc_mark_alive_workers
+        set_gc_mark_alive_workers(args.workers)
+
+    gil = sys._is_gil_enabled() if hasattr(sys, '_is_gil_enabled') else True
+    print(f"GIL {'enabled' if gil else 'disabled'}, "
+          f"{args.objects}k objects")
+    print(f"{'Threads': <10}{'Min (ms)': >12}{'Median (ms)': >14}")
+    for num_threads in args.threads:
+        times = sorted(measure(num_threads, args.objects * 1000,
+                               args.repeat))
+        median = times[len(times) // 2]
+        print(f"{num_threads: <10}{times[0] * 1e3: >12.1f}"
+              f"{median * 1e3: >14.1f}")
+
+
+if __name__ == "__main__":
+    main()
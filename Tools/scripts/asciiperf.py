@@ -0,0 +1,130 @@
+"""
+ASCII fast path performance test for the str and bytes types.
+
+The benchmarks exercise ASCII detection (bytes.isascii), ASCII and UTF-8
+decoding, UTF-8 encoding, and the maximum character scan done when a str
+is created from a buffer.
+
+To install `pyperf` you would need to:
+
+    python3 -m pip install pyperf
+
+To run:
+
+    python3 Tools/scripts/asciiperf.py
+
+Options:
+
+    * `benchmark` name to run
+    * `--size` to set the input size in bytes
+"""
+
+import argparse
+import time
+
+
+# ===============
+# Data generation
+# ===============
+
+def make_ascii(size):
+    text = b"The quick brown fox jumps over the lazy dog. "
+    return (text * (size // len(text) + 1))[:size]
+
+
+def make_utf8_tail(size):
+    # Non-ASCII character at the very end: the whole input has to be scanned.
+    return make_ascii(size - 2) + "\xe9".encode("utf-8")
+
+
+def make_mixed(size):
+    text = "Grüße aus Köln, ça va? ".encode("utf-8")
+    return (text * (size // len(text) + 1))[:size].decode(
+        "utf-8", "ignore").encode("utf-8")
+
+
+def bench_isascii(data):
+    return data.isascii
+
+
+def bench_decode_ascii(data):
+    return lambda: data.decode("ascii")
+
+
+def bench_decode_utf8(data):
+    return lambda: data.decode("utf-8")
+
+
+def bench_decode_latin1(data):
+    # PyUnicode_DecodeLatin1() computes the maximum character first.
+    return lambda: data.decode("latin-1")
+
+
+def bench_encode_utf8(data):
+    s = data.decode("utf-8")
+    return s.encode
+
+
+# =========
+# Benchmark
+# =========
+
+def run(loops, func):
+    range_it = range(loops)
+    start = time.perf_counter()
+    for _ in range_it:
+        func()
+    return time.perf_counter() - start
+
+
+def add_cmdline_args(cmd, args):
+    if args.benchmark:
+        cmd.append(args.benchmark)
+    cmd.append(f"--size={args.size}")
+
+
+def add_parser_args(parser):
+    parser.add_argument(
+        "benchmark",
+        choices=BENCHMARKS,
+        nargs="?",
+        help="Can be any of: {0}".format(", ".join(BENCHMARKS)),
+    )
+    parser.add_argument(
+        "--size",
+        type=int,
+        default=DEFAULT_SIZE,
+        help=f"Size of the input in bytes (default: {DEFAULT_SIZE})",
+    )
+
+
+DEFAULT_SIZE = 1 << 16
+BENCHMARKS = {
+    "isascii": (bench_isascii, make_ascii),
+    "decode_ascii": (bench_decode_ascii, make_ascii),
+    "decode_utf8_ascii": (bench_decode_utf8, make_ascii),
+    "decode_utf8_tail": (bench_decode_utf8, make_utf8_tail),
+    "decode_utf8_mixed": (bench_decode_utf8, make_mixed),
+    "decode_latin1": (bench_decode_latin1, make_ascii),
+    "encode_utf8_ascii": (bench_encode_utf8, make_ascii),
+    "encode_utf8_mixed": (bench_encode_utf8, make_mixed),
+}
+
+if __name__ == "__main__":
+    # This needs `pyperf` 3rd party library:
+    import pyperf
+
+    runner = pyperf.Runner(add_cmdline_args=add_cmdline_args)
+    add_parser_args(runner.argparser)
+    args = runner.parse_args()
+
+    runner.metadata["description"] = "Test the ASCII fast paths of str and bytes"
+    runner.metadata["asciiperf_size"] = args.size
+
+    if args.benchmark:
+        benchmarks = (args.benchmark,)
+    else:
+        benchmarks = sorted(BENCHMARKS)
+    for name in benchmarks:
+        bench, make = BENCHMARKS[name]
+        runner.bench_time_func(name, run, bench(make(args.size)))
@@ -0,0 +1,130 @@
+"""
+Short-needle search performance test for the str and bytes types.
+
+The benchmarks mimic log and header parsing: searching for delimiters and
+field names of 2 to 16 characters in lines of text.  They run on ASCII str,
+on str with non-Latin-1 characters (2 bytes per character) and on bytes.
+
+To install `pyperf` you would need to:
+
+    python3 -m pip install pyperf
+
+To run:
+
+    python3 Tools/scripts/findperf.py
+
+Options:
+
+    * `benchmark` name to run, such as `find_status_ucs2`
+    * `--size` to set the haystack length
+"""
+
+import argparse
+import time
+
+
+# ===============
+# Data generation
+# ===============
+
+LOG_LINE = ('127.0.0.1 - - [10/Oct/2000:13:55:36 -0700] '
+            '"GET /apache_pb.gif HTTP/1.0" 200 2326 '
+            '"http://www.example.com/start.html" "Mozilla/4.08"\r\n')
+
+HEADERS = ('Host: www.example.com\r\n'
+           'User-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n'
+           'Accept: text/html,application/xhtml+xml\r\n'
+           'Accept-Language: en-US,en;q=0.5\r\n'
+           'Connection: keep-alive\r\n')
+
+
+def make_text(kind, line, size):
+    text = (line * (size // len(line) + 1))[:size]
+    if kind == "ucs2":
+        text = text.replace("Mozilla", "Moziłła")
+    elif kind == "bytes":
+        text = text.encode("ascii")
+    return text
+
+
+def needle(kind, s):
+    return s.encode("ascii") if kind == "bytes" else s
+
+
+OPERATIONS = {
+    # name: (haystack line, operation)
+    "find_missing": (LOG_LINE,
+                     lambda k: lambda t: t.find(needle(k, "ERROR"))),
+    "find_status": (LOG_LINE,
+                    lambda k: lambda t: t.find(needle(k, " 404 "))),
+    "find_header": (HEADERS,
+                    lambda k: lambda t: t.find(needle(k, "Content-Length"))),
+    "count_crlf": (LOG_LINE, lambda k: lambda t: t.count(needle(k, "\r\n"))),
+    "split_fields": (HEADERS, lambda k: lambda t: t.split(needle(k, ": "))),
+    "partition_date": (LOG_LINE,
+                       lambda k: lambda t: t.partition(needle(k, "-0700]"))),
+    "replace_crlf": (LOG_LINE, lambda k: lambda t: t.replace(
+        needle(k, "\r\n"), needle(k, "\n"))),
+}
+
+KINDS = ("ascii", "ucs2", "bytes")
+
+
+# =========
+# Benchmark
+# =========
+
+def run(loops, func, text):
+    range_it = range(loops)
+    start = time.perf_counter()
+    for _ in range_it:
+        func(text)
+    return time.perf_counter() - start
+
+
+def add_cmdline_args(cmd, args):
+    if args.benchmark:
+        cmd.append(args.benchmark)
+    cmd.append(f"--size={args.size}")
+
+
+def add_parser_args(parser):
+    parser.add_argument(
+        "benchmark",
+        choices=BENCHMARKS,
+        nargs="?",
+        help="Can be any of: {0}".format(", ".join(BENCHMARKS)),
+    )
+    parser.add_argument(
+        "--size",
+        type=int,
+        default=DEFAULT_SIZE,
+        help=f"Length of the haystack (default: {DEFAULT_SIZE})",
+    )
+
+
+DEFAULT_SIZE = 2000
+BENCHMARKS = {
+    f"{name}_{kind}": (name, kind) for name in OPERATIONS for kind in KINDS
+}
+
+if __name__ == "__main__":
+    # This needs `pyperf` 3rd party library:
+    import pyperf
+
+    runner = pyperf.Runner(add_cmdline_args=add_cmdline_args)
+    add_parser_args(runner.argparser)
+    args = runner.parse_args()
+
+    runner.metadata["description"] = "Test str and bytes short-needle search"
+    runner.metadata["findperf_size"] = args.size
+
+    if args.benchmark:
+        benchmarks = (args.benchmark,)
+    else:
+        benchmarks = sorted(BENCHMARKS)
+    for bench in benchmarks:
+        name, kind = BENCHMARKS[bench]
+        line, op = OPERATIONS[name]
+        runner.bench_time_func(bench, run, op(kind),
+                               make_text(kind, line, args.size))